@@ -0,0 +1,275 @@
+#pragma once
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#endif
+
+// Аллокатор по умолчанию: сырая память выделяется глобальными operator new/delete
+template <typename T>
+class NewDeleteAllocator {
+public:
+    T* Allocate(size_t n) {
+        return n != 0 ? static_cast<T*>(operator new(n * sizeof(T))) : nullptr;
+    }
+
+    void Deallocate(T* buf, size_t /*n*/) noexcept {
+        operator delete(buf);
+    }
+};
+
+// Аллокатор с гарантированным выравниванием блока (например, 64 байта под
+// AVX-512). Через AdjustCapacity ёмкость округляется вверх до целого числа
+// выравненных порций, чтобы векторизованные циклы обходились без хвоста
+template <typename T, size_t Align>
+class AlignedAllocator {
+public:
+    static_assert((Align & (Align - 1)) == 0, "выравнивание должно быть степенью двойки");
+    static_assert(Align >= alignof(T), "выравнивание не может быть меньше alignof(T)");
+
+    T* Allocate(size_t n) {
+        return n != 0 ? static_cast<T*>(operator new(n * sizeof(T), std::align_val_t{Align})) : nullptr;
+    }
+
+    void Deallocate(T* buf, size_t /*n*/) noexcept {
+        operator delete(buf, std::align_val_t{Align});
+    }
+
+    // Округляет ёмкость вверх до кратной Align байтам
+    size_t AdjustCapacity(size_t n) const noexcept {
+        constexpr size_t ELEMS_PER_ALIGN = (Align + sizeof(T) - 1) / sizeof(T);
+        return (n + ELEMS_PER_ALIGN - 1) / ELEMS_PER_ALIGN * ELEMS_PER_ALIGN;
+    }
+};
+
+// Аллокатор на malloc/free: в отличие от NewDeleteAllocator умеет Reallocate,
+// благодаря чему RawMemory::TryGrow расширяет блок силами libc — для больших
+// блоков это mremap без копирования байтов и без транзитного удвоения RSS
+template <typename T>
+class MallocAllocator {
+public:
+    T* Allocate(size_t n) {
+        if (n == 0) {
+            return nullptr;
+        }
+        void* buf = std::malloc(n * sizeof(T));
+        if (buf == nullptr) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(buf);
+    }
+
+    void Deallocate(T* buf, size_t /*n*/) noexcept {
+        std::free(buf);
+    }
+
+    // Меняет размер блока, сохраняя содержимое; применимо только к тривиально
+    // копируемым типам — байты может переносить сам realloc
+    T* Reallocate(T* buf, size_t /*old_n*/, size_t new_n) {
+        void* new_buf = std::realloc(buf, new_n * sizeof(T));
+        if (new_buf == nullptr) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(new_buf);
+    }
+};
+
+// Монотонная арена: выделяет память сдвигом указателя внутри одного заранее
+// выделенного блока. Отдельные выделения не освобождаются — вся арена
+// возвращается в исходное состояние одним вызовом Reset
+class MonotonicArena {
+public:
+    explicit MonotonicArena(size_t capacity_bytes)
+        : begin_(static_cast<unsigned char*>(operator new(capacity_bytes)))
+        , cursor_(begin_)
+        , end_(begin_ + capacity_bytes) {
+    }
+
+    MonotonicArena(const MonotonicArena&) = delete;
+    MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+    ~MonotonicArena() {
+        operator delete(begin_);
+    }
+
+    void* Allocate(size_t bytes, size_t alignment) {
+        size_t padding = (alignment - reinterpret_cast<size_t>(cursor_) % alignment) % alignment;
+        if (bytes + padding > static_cast<size_t>(end_ - cursor_)) {
+            throw std::bad_alloc();
+        }
+        cursor_ += padding;
+        void* result = cursor_;
+        cursor_ += bytes;
+        return result;
+    }
+
+    // Освобождает все выделения разом; живых объектов в арене быть не должно
+    void Reset() noexcept {
+        cursor_ = begin_;
+    }
+
+    size_t BytesUsed() const noexcept {
+        return static_cast<size_t>(cursor_ - begin_);
+    }
+
+private:
+    unsigned char* begin_;
+    unsigned char* cursor_;
+    unsigned char* end_;
+};
+
+// Аллокатор поверх MonotonicArena: Deallocate ничего не делает,
+// память возвращается целиком через MonotonicArena::Reset
+template <typename T>
+class MonotonicArenaAllocator {
+public:
+    explicit MonotonicArenaAllocator(MonotonicArena& arena) noexcept
+        : arena_(&arena) {
+    }
+
+    T* Allocate(size_t n) {
+        return n != 0 ? static_cast<T*>(arena_->Allocate(n * sizeof(T), alignof(T))) : nullptr;
+    }
+
+    void Deallocate(T* /*buf*/, size_t /*n*/) noexcept {
+    }
+
+private:
+    MonotonicArena* arena_;
+};
+
+#if defined(__unix__) || defined(__APPLE__)
+
+// Аллокатор на mmap с крупными страницами для многогигабайтных буферов:
+// сначала пробует явные huge pages (MAP_HUGETLB), а если пул hugetlbfs пуст,
+// отображает обычные анонимные страницы и просит ядро склеить их в прозрачные
+// huge pages через madvise(MADV_HUGEPAGE). Привязку к NUMA-узлам даёт политика
+// first-touch: страницы отображаются лениво, поэтому достаточно заполнить
+// вектор потоками нужных сокетов (например, Resize с num_threads)
+template <typename T>
+class HugePageAllocator {
+public:
+    static constexpr size_t HUGE_PAGE_BYTES = 2 * 1024 * 1024;
+
+    T* Allocate(size_t n) {
+        if (n == 0) {
+            return nullptr;
+        }
+        size_t bytes = RoundUpToPage(n * sizeof(T));
+#ifdef MAP_HUGETLB
+        void* buf = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (buf != MAP_FAILED) {
+            return static_cast<T*>(buf);
+        }
+#endif
+        void* fallback = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (fallback == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+#ifdef MADV_HUGEPAGE
+        ::madvise(fallback, bytes, MADV_HUGEPAGE);
+#endif
+        return static_cast<T*>(fallback);
+    }
+
+    void Deallocate(T* buf, size_t n) noexcept {
+        if (buf != nullptr) {
+            ::munmap(buf, RoundUpToPage(n * sizeof(T)));
+        }
+    }
+
+    // mmap всё равно выделяет целые страницы — пусть вектор их использует
+    size_t AdjustCapacity(size_t n) const noexcept {
+        return RoundUpToPage(n * sizeof(T)) / sizeof(T);
+    }
+
+private:
+    static size_t RoundUpToPage(size_t bytes) noexcept {
+        return (bytes + HUGE_PAGE_BYTES - 1) / HUGE_PAGE_BYTES * HUGE_PAGE_BYTES;
+    }
+};
+
+#endif
+
+// Пул свободных блоков на поток: блоки группируются по классам размера
+// (степени двойки), освобождённый блок кладётся в список своего класса
+// и переиспользуется следующим Allocate без обращения к куче
+template <typename T>
+class ThreadLocalPoolAllocator {
+public:
+    T* Allocate(size_t n) {
+        if (n == 0) {
+            return nullptr;
+        }
+        size_t size_class = SizeClass(n * sizeof(T));
+        FreeBlock*& head = Pool()[size_class];
+        if (head != nullptr) {
+            FreeBlock* block = head;
+            head = block->next;
+            return reinterpret_cast<T*>(block);
+        }
+        return static_cast<T*>(operator new(ClassBytes(size_class)));
+    }
+
+    void Deallocate(T* buf, size_t n) noexcept {
+        if (buf == nullptr) {
+            return;
+        }
+        size_t size_class = SizeClass(n * sizeof(T));
+        FreeBlock* block = reinterpret_cast<FreeBlock*>(buf);
+        block->next = Pool()[size_class];
+        Pool()[size_class] = block;
+    }
+
+    // Блок занимает весь свой класс размера — пусть ёмкость это отражает,
+    // тогда запас достаётся вектору, а не простаивает в хвосте блока
+    size_t AdjustCapacity(size_t n) const noexcept {
+        return n != 0 ? ClassBytes(SizeClass(n * sizeof(T))) / sizeof(T) : 0;
+    }
+
+    // Возвращает накопленные блоки текущего потока куче — для пауз между
+    // запросами, когда пул держит память впустую
+    static void TrimPools() noexcept {
+        for (FreeBlock*& head : Pool()) {
+            while (head != nullptr) {
+                FreeBlock* block = head;
+                head = block->next;
+                operator delete(block);
+            }
+        }
+    }
+
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    static constexpr size_t NUM_CLASSES = 48;
+
+    // Номер класса — позиция старшего бита размера, округлённого вверх
+    // до степени двойки и не меньше sizeof(FreeBlock)
+    static size_t SizeClass(size_t bytes) noexcept {
+        size_t size_class = 0;
+        while (ClassBytes(size_class) < bytes || ClassBytes(size_class) < sizeof(FreeBlock)) {
+            ++size_class;
+        }
+        assert(size_class < NUM_CLASSES);
+        return size_class;
+    }
+
+    static constexpr size_t ClassBytes(size_t size_class) noexcept {
+        return size_t{1} << size_class;
+    }
+
+    static std::array<FreeBlock*, NUM_CLASSES>& Pool() noexcept {
+        static thread_local std::array<FreeBlock*, NUM_CLASSES> pool{};
+        return pool;
+    }
+};
@@ -0,0 +1,222 @@
+// Микробенчмарки Vector<T> против std::vector<T> на горячих операциях.
+// Самодостаточная программа без внешних зависимостей; собирается отдельно:
+//   g++ -std=c++17 -O2 -o benchmarks benchmarks.cpp
+#include "vector.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+    // Тривиально копируемый элемент — заголовок пакета
+    struct Pod {
+        uint64_t timestamp;
+        uint32_t id;
+        uint32_t flags;
+    };
+
+    // Элемент с noexcept-перемещением и нетривиальным разрушением
+    struct Movable {
+        Movable() = default;
+        explicit Movable(int id)
+            : payload(16, static_cast<char>('a' + id % 26)) {
+        }
+        std::string payload;
+    };
+
+    // Элемент только с копированием — худший случай для реаллокации
+    struct CopyOnly {
+        CopyOnly() = default;
+        CopyOnly(const CopyOnly&) = default;
+        CopyOnly& operator=(const CopyOnly&) = default;
+        CopyOnly(CopyOnly&&) = delete;
+        CopyOnly& operator=(CopyOnly&&) = delete;
+        int id = 0;
+    };
+
+    // Не даёт оптимизатору выбросить результат
+    template <typename T>
+    void DoNotOptimize(const T& value) {
+        asm volatile("" : : "g"(&value) : "memory");
+    }
+
+    using Clock = std::chrono::steady_clock;
+
+    // Запускает op repeat раз и печатает лучшее время — так меньше шума планировщика
+    template <typename Op>
+    void RunBench(const std::string& name, Op op, int repeat = 5) {
+        double best_ms = 1e100;
+        for (int i = 0; i < repeat; ++i) {
+            auto start = Clock::now();
+            op();
+            auto elapsed = std::chrono::duration<double, std::milli>(Clock::now() - start);
+            best_ms = std::min(best_ms, elapsed.count());
+        }
+        std::cout << std::left << std::setw(44) << name << std::fixed << std::setprecision(3)
+            << best_ms << " ms" << std::endl;
+    }
+
+    constexpr size_t NUM = 1'000'000;
+    constexpr size_t MID_NUM = 10'000;
+
+    template <typename V, typename MakeElem>
+    void FillByPushBack(size_t n, MakeElem make) {
+        V v;
+        for (size_t i = 0; i < n; ++i) {
+            v.PushBack(make(i));
+        }
+        DoNotOptimize(v);
+    }
+
+    template <typename V, typename MakeElem>
+    void FillByPushBackStd(size_t n, MakeElem make) {
+        V v;
+        for (size_t i = 0; i < n; ++i) {
+            v.push_back(make(i));
+        }
+        DoNotOptimize(v);
+    }
+
+    template <typename T, typename MakeElem>
+    void BenchGrowth(const std::string& type_name, MakeElem make) {
+        RunBench("PushBack growth " + type_name + " [Vector]", [&] {
+            FillByPushBack<Vector<T>>(NUM, make);
+            });
+        RunBench("PushBack growth " + type_name + " [std::vector]", [&] {
+            FillByPushBackStd<std::vector<T>>(NUM, make);
+            });
+    }
+
+}  // namespace
+
+int main() {
+    auto make_pod = [](size_t i) { return Pod{i, static_cast<uint32_t>(i), 0}; };
+    auto make_movable = [](size_t i) { return Movable{static_cast<int>(i)}; };
+
+    BenchGrowth<Pod>("Pod", make_pod);
+    BenchGrowth<Movable>("Movable", make_movable);
+    RunBench("PushBack growth CopyOnly [Vector]", [] {
+        Vector<CopyOnly> v;
+        CopyOnly elem;
+        for (size_t i = 0; i < NUM / 10; ++i) {
+            v.PushBack(elem);
+        }
+        DoNotOptimize(v);
+        });
+    RunBench("PushBack growth CopyOnly [std::vector]", [] {
+        std::vector<CopyOnly> v;
+        CopyOnly elem;
+        for (size_t i = 0; i < NUM / 10; ++i) {
+            v.push_back(elem);
+        }
+        DoNotOptimize(v);
+        });
+
+    RunBench("Reserve+fill Pod [Vector]", [&] {
+        Vector<Pod> v;
+        v.Reserve(NUM);
+        for (size_t i = 0; i < NUM; ++i) {
+            v.EmplaceBack(make_pod(i));
+        }
+        DoNotOptimize(v);
+        });
+    RunBench("Reserve+fill Pod [std::vector]", [&] {
+        std::vector<Pod> v;
+        v.reserve(NUM);
+        for (size_t i = 0; i < NUM; ++i) {
+            v.emplace_back(make_pod(i));
+        }
+        DoNotOptimize(v);
+        });
+
+    RunBench("Insert front Pod [Vector]", [&] {
+        Vector<Pod> v;
+        for (size_t i = 0; i < MID_NUM; ++i) {
+            v.Insert(v.cbegin(), make_pod(i));
+        }
+        DoNotOptimize(v);
+        });
+    RunBench("Insert front Pod [std::vector]", [&] {
+        std::vector<Pod> v;
+        for (size_t i = 0; i < MID_NUM; ++i) {
+            v.insert(v.cbegin(), make_pod(i));
+        }
+        DoNotOptimize(v);
+        });
+
+    RunBench("Emplace middle Movable [Vector]", [&] {
+        Vector<Movable> v;
+        for (size_t i = 0; i < MID_NUM; ++i) {
+            v.Emplace(v.cbegin() + v.Size() / 2, static_cast<int>(i));
+        }
+        DoNotOptimize(v);
+        });
+    RunBench("Emplace middle Movable [std::vector]", [&] {
+        std::vector<Movable> v;
+        for (size_t i = 0; i < MID_NUM; ++i) {
+            v.emplace(v.cbegin() + v.size() / 2, static_cast<int>(i));
+        }
+        DoNotOptimize(v);
+        });
+
+    RunBench("Erase front half Pod [Vector]", [&] {
+        Vector<Pod> v;
+        for (size_t i = 0; i < MID_NUM; ++i) {
+            v.PushBack(make_pod(i));
+        }
+        while (v.Size() > MID_NUM / 2) {
+            v.Erase(v.cbegin());
+        }
+        DoNotOptimize(v);
+        });
+    RunBench("Erase front half Pod [std::vector]", [&] {
+        std::vector<Pod> v;
+        for (size_t i = 0; i < MID_NUM; ++i) {
+            v.push_back(make_pod(i));
+        }
+        while (v.size() > MID_NUM / 2) {
+            v.erase(v.cbegin());
+        }
+        DoNotOptimize(v);
+        });
+
+    {
+        Vector<Movable> src;
+        std::vector<Movable> src_std;
+        for (size_t i = 0; i < NUM / 10; ++i) {
+            src.PushBack(make_movable(i));
+            src_std.push_back(make_movable(i));
+        }
+        RunBench("Copy assignment Movable [Vector]", [&] {
+            Vector<Movable> dst;
+            dst = src;
+            DoNotOptimize(dst);
+            });
+        RunBench("Copy assignment Movable [std::vector]", [&] {
+            std::vector<Movable> dst;
+            dst = src_std;
+            DoNotOptimize(dst);
+            });
+        RunBench("Move assignment + Swap Movable [Vector]", [&] {
+            Vector<Movable> a(src);
+            Vector<Movable> b;
+            for (int i = 0; i < 1000; ++i) {
+                b = std::move(a);
+                b.Swap(a);
+            }
+            DoNotOptimize(a);
+            });
+        RunBench("Move assignment + swap Movable [std::vector]", [&] {
+            std::vector<Movable> a(src_std);
+            std::vector<Movable> b;
+            for (int i = 0; i < 1000; ++i) {
+                b = std::move(a);
+                b.swap(a);
+            }
+            DoNotOptimize(a);
+            });
+    }
+}
@@ -0,0 +1,189 @@
+#include "segmented_vector.h"
+#include "shared_vector.h"
+#include "sorted_vector.h"
+#include "vector_io.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <vector>
+
+// Проверки контейнеров-спутников, не покрытых main.cpp и stress_test.cpp:
+// SortedVector, SharedVector, SegmentedVector и сериализация vector_io.h.
+// Запуск: g++ -std=c++17 -O1 container_tests.cpp && ./a.out
+
+namespace {
+
+void TestSortedVectorInsert() {
+    SortedVector<int> sv;
+    for (int x : {5, 1, 9, 3, 7, 5}) {
+        sv.Insert(x);
+    }
+    assert(sv.Size() == 6);
+    assert(std::is_sorted(sv.begin(), sv.end()));
+    assert(sv.Contains(5) && sv.Contains(9) && !sv.Contains(4));
+    assert(*sv.LowerBound(6) == 7);
+    assert(sv.LowerBound(10) == sv.end());
+}
+
+void TestSortedVectorInsertBatch() {
+    std::mt19937 gen(42);
+    SortedVector<int> sv;
+    std::vector<int> oracle;
+    for (int round = 0; round < 5; ++round) {
+        std::vector<int> batch(200);
+        for (int& x : batch) {
+            x = static_cast<int>(gen() % 100);
+        }
+        sv.InsertBatch(batch.begin(), batch.end());
+        oracle.insert(oracle.end(), batch.begin(), batch.end());
+    }
+    std::sort(oracle.begin(), oracle.end());
+    assert(sv.Size() == oracle.size());
+    assert(std::equal(sv.begin(), sv.end(), oracle.begin()));
+}
+
+void TestSortedVectorLazyMerge() {
+    SortedVector<int> sv;
+    sv.SetLazyMergeLimit(64);
+    for (int i = 50; i > 0; --i) {
+        sv.Insert(i);
+    }
+    // хвост не отсортирован, но первый поиск досортировывает
+    assert(sv.Contains(25));
+    assert(std::is_sorted(sv.begin(), sv.end()));
+    // до лимита вставки не трогают отсортированную часть,
+    // достижение лимита сливает хвост само
+    for (int i = 100; i < 170; ++i) {
+        sv.Insert(i);
+    }
+    assert(sv.Size() == 120);
+    // SetLazyMergeLimit(0) сливает остаток и возвращает немедленную вставку
+    sv.Insert(-1);
+    sv.SetLazyMergeLimit(0);
+    sv.Insert(-2);
+    assert(sv[0] == -2 && sv[1] == -1);
+    assert(std::is_sorted(sv.begin(), sv.end()));
+}
+
+void TestSortedVectorErase() {
+    SortedVector<int, std::greater<int>> sv{std::greater<int>{}};
+    int values[] = {4, 8, 15, 16, 23, 42};
+    sv.InsertBatch(std::begin(values), std::end(values));
+    assert(std::is_sorted(sv.begin(), sv.end(), std::greater<int>{}));
+    assert(sv.Erase(15));
+    assert(!sv.Erase(15));
+    assert(!sv.Erase(100));
+    assert(sv.Size() == 5 && !sv.Contains(15) && sv.Contains(42));
+    // Erase находит элемент и в ленивом хвосте
+    sv.SetLazyMergeLimit(16);
+    sv.Insert(99);
+    assert(sv.Erase(99));
+    assert(sv.Size() == 5);
+}
+
+void TestSharedVectorFreezeThaw() {
+    Vector<int> v;
+    for (int i = 0; i < 100; ++i) {
+        v.PushBack(i);
+    }
+    const int* buf = v.begin();
+
+    SharedVector<int> snapshot = v.Freeze();
+    assert(v.Size() == 0);
+    assert(snapshot.Size() == 100 && snapshot[42] == 42);
+    // снимок владеет прежним буфером, копия снимка — инкремент счётчика
+    assert(snapshot.begin() == buf);
+    SharedVector<int> reader = snapshot;
+    assert(snapshot.UseCount() == 2 && reader.begin() == buf);
+
+    // Thaw при живом соседе — глубокая копия, сосед видит прежний снимок
+    Vector<int> thawed = snapshot.Thaw();
+    assert(thawed.begin() != buf && thawed.Size() == 100 && thawed[7] == 7);
+    assert(reader.UseCount() == 1 && reader[99] == 99);
+
+    // Thaw единственного держателя забирает буфер без копирования
+    Vector<int> stolen = reader.Thaw();
+    assert(stolen.begin() == buf && stolen.Size() == 100);
+    assert(reader.Size() == 0);
+}
+
+void TestVectorIoRoundTrip() {
+    Vector<int> v;
+    for (int i = 0; i < 1000; ++i) {
+        v.PushBack(i * 3);
+    }
+    std::stringstream ss;
+    WriteTo(v, ss);
+    Vector<int> restored = ReadFrom<int>(ss);
+    assert(restored.Size() == v.Size());
+    assert(std::equal(v.begin(), v.end(), restored.begin()));
+
+    // усечённый поток — исключение
+    std::string bytes = ss.str();
+    bytes.resize(bytes.size() / 2);
+    std::stringstream truncated(bytes);
+    bool threw = false;
+    try {
+        ReadFrom<int>(truncated);
+    }
+    catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert(threw);
+
+    // переполняющий заголовок — исключение, а не крошечный буфер
+    uint64_t evil = (uint64_t{1} << 61) + 2;
+    std::stringstream corrupt;
+    corrupt.write(reinterpret_cast<const char*>(&evil), sizeof(evil));
+    corrupt.write("0123456789abcdef", 16);
+    threw = false;
+    try {
+        ReadFrom<double>(corrupt);
+    }
+    catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert(threw);
+}
+
+void TestSegmentedVectorGrowth() {
+    SegmentedVector<std::string, 16> sv;
+    sv.EmplaceBack("first");
+    const std::string* stable = &sv[0];
+    for (int i = 1; i < 1000; ++i) {
+        sv.EmplaceBack(std::to_string(i));
+    }
+    // рост никогда не переносит уже построенные элементы
+    assert(&sv[0] == stable && sv[0] == "first");
+    assert(sv.Size() == 1000 && sv[999] == "999");
+
+    SegmentedVector<std::string, 16> copy(sv);
+    assert(copy.Size() == 1000 && copy[500] == "500");
+    copy.PopBack();
+    assert(copy.Size() == 999 && sv.Size() == 1000);
+
+    SegmentedVector<std::string, 16> moved(std::move(copy));
+    assert(moved.Size() == 999 && copy.Size() == 0);
+    assert(&sv[0] == stable);
+
+    // итераторы произвольного доступа пригодны для алгоритмов
+    assert(std::count(sv.begin(), sv.end(), std::string("42")) == 1);
+}
+
+}  // namespace
+
+int main() {
+    TestSortedVectorInsert();
+    TestSortedVectorInsertBatch();
+    TestSortedVectorLazyMerge();
+    TestSortedVectorErase();
+    TestSharedVectorFreezeThaw();
+    TestVectorIoRoundTrip();
+    TestSegmentedVectorGrowth();
+    std::cout << "All container tests passed" << std::endl;
+}
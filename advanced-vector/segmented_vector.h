@@ -0,0 +1,220 @@
+#pragma once
+#include "vector.h"
+
+// Сегментированный вектор: элементы лежат в цепочке блоков фиксированного
+// размера, добавление в конец никогда не переносит уже построенные элементы.
+// Это даёт стабильность указателей и ограниченную паузу на рост (выделение
+// одного блока) ценой одного лишнего разыменования при доступе по индексу
+template <typename T, size_t BlockSize = 1024, typename Alloc = NewDeleteAllocator<T>>
+class SegmentedVector {
+public:
+    static_assert(BlockSize > 0, "SegmentedVector требует ненулевой размер блока");
+
+    SegmentedVector() = default;
+
+    SegmentedVector(const SegmentedVector& other) {
+        try {
+            for (size_t i = 0; i < other.size_; ++i) {
+                this->EmplaceBack(other[i]);
+            }
+        }
+        catch (...) {
+            // Деструктор недостроенного объекта не выполнится, а RawMemory
+            // освобождает только сырые байты — зачищаем построенное сами
+            Clear();
+            throw;
+        }
+    }
+
+    SegmentedVector(SegmentedVector&& other) noexcept
+        : blocks_(std::move(other.blocks_))
+        , size_(other.size_)
+    {
+        other.size_ = 0;
+    }
+
+    SegmentedVector& operator=(const SegmentedVector& rhs) {
+        if (this != &rhs) {
+            SegmentedVector rhs_copy(rhs);
+            this->Swap(rhs_copy);
+        }
+        return *this;
+    }
+
+    SegmentedVector& operator=(SegmentedVector&& rhs) noexcept {
+        if (this != &rhs) {
+            this->Swap(rhs);
+        }
+        return *this;
+    }
+
+    ~SegmentedVector() {
+        Clear();
+    }
+
+    template <bool IsConst>
+    class Iterator {
+        friend class SegmentedVector;
+        using Parent = std::conditional_t<IsConst, const SegmentedVector, SegmentedVector>;
+
+        Iterator(Parent* parent, size_t index) noexcept
+            : parent_(parent)
+            , index_(index) {
+        }
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+
+        Iterator() = default;
+
+        reference operator*() const noexcept {
+            return (*parent_)[index_];
+        }
+
+        pointer operator->() const noexcept {
+            return &(*parent_)[index_];
+        }
+
+        Iterator& operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept {
+            Iterator result = *this;
+            ++index_;
+            return result;
+        }
+
+        Iterator& operator--() noexcept {
+            --index_;
+            return *this;
+        }
+
+        Iterator& operator+=(difference_type n) noexcept {
+            index_ += n;
+            return *this;
+        }
+
+        Iterator operator+(difference_type n) const noexcept {
+            return Iterator(parent_, index_ + n);
+        }
+
+        Iterator operator-(difference_type n) const noexcept {
+            return Iterator(parent_, index_ - n);
+        }
+
+        difference_type operator-(const Iterator& rhs) const noexcept {
+            return static_cast<difference_type>(index_) - static_cast<difference_type>(rhs.index_);
+        }
+
+        bool operator==(const Iterator& rhs) const noexcept {
+            return index_ == rhs.index_;
+        }
+
+        bool operator!=(const Iterator& rhs) const noexcept {
+            return index_ != rhs.index_;
+        }
+
+        bool operator<(const Iterator& rhs) const noexcept {
+            return index_ < rhs.index_;
+        }
+
+    private:
+        Parent* parent_ = nullptr;
+        size_t index_ = 0;
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    iterator begin() noexcept {
+        return iterator(this, 0);
+    }
+
+    iterator end() noexcept {
+        return iterator(this, size_);
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator(this, size_);
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    size_t Capacity() const noexcept {
+        return blocks_.Size() * BlockSize;
+    }
+
+    // Заранее выделяет блоки под new_capacity элементов
+    void Reserve(size_t new_capacity) {
+        while (Capacity() < new_capacity) {
+            blocks_.EmplaceBack(BlockSize);
+        }
+    }
+
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args) {
+        if (size_ == Capacity()) {
+            blocks_.EmplaceBack(BlockSize);
+        }
+        T* slot = blocks_[size_ / BlockSize].GetAddress() + size_ % BlockSize;
+        new (slot) T(std::forward<Args>(args)...);
+        ++size_;
+        return *slot;
+    }
+
+    template <typename Value>
+    void PushBack(Value&& value) {
+        this->EmplaceBack(std::forward<Value>(value));
+    }
+
+    void PopBack() {
+        std::destroy_at(&(*this)[size_ - 1]);
+        --size_;
+    }
+
+    // Разрушает все элементы; выделенные блоки сохраняются для переиспользования
+    void Clear() noexcept {
+        for (size_t block = 0; block * BlockSize < size_; ++block) {
+            size_t count = std::min(BlockSize, size_ - block * BlockSize);
+            DestroyData(blocks_[block].GetAddress(), count);
+        }
+        size_ = 0;
+    }
+
+    void Swap(SegmentedVector& other) noexcept {
+        blocks_.Swap(other.blocks_);
+        std::swap(size_, other.size_);
+    }
+
+    const T& operator[](size_t index) const noexcept {
+        return blocks_[index / BlockSize][index % BlockSize];
+    }
+
+    T& operator[](size_t index) noexcept {
+        return blocks_[index / BlockSize][index % BlockSize];
+    }
+
+private:
+    Vector<RawMemory<T, Alloc>> blocks_;
+    size_t size_ = 0;
+};
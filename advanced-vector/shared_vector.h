@@ -0,0 +1,66 @@
+#pragma once
+#include "vector.h"
+
+// Неизменяемый снимок вектора с разделяемым владением: раздача снимка десяткам
+// читателей — это инкремент атомарного счётчика ссылок, а не глубокая копия.
+// Создаётся методом Vector::Freeze, глубокая копия выполняется только когда
+// держатель просит изменяемую версию через Thaw при живых соседях
+template <typename T, typename Alloc = NewDeleteAllocator<T>>
+class SharedVector {
+    friend class Vector<T, Alloc>;
+
+    explicit SharedVector(Vector<T, Alloc>&& vector)
+        : impl_(std::make_shared<Vector<T, Alloc>>(std::move(vector))) {
+    }
+
+public:
+    SharedVector() = default;
+
+    using const_iterator = typename Vector<T, Alloc>::const_iterator;
+
+    const_iterator begin() const noexcept {
+        return impl_ ? impl_->begin() : nullptr;
+    }
+
+    const_iterator end() const noexcept {
+        return impl_ ? impl_->end() : nullptr;
+    }
+
+    size_t Size() const noexcept {
+        return impl_ ? impl_->Size() : 0;
+    }
+
+    const T& operator[](size_t index) const noexcept {
+        return (*impl_)[index];
+    }
+
+    // Число держателей снимка
+    long UseCount() const noexcept {
+        return impl_.use_count();
+    }
+
+    // Возвращает изменяемый вектор. Если снимок больше никому не принадлежит,
+    // буфер забирается без копирования; иначе выполняется глубокая копия,
+    // а остальные держатели продолжают видеть прежний снимок
+    Vector<T, Alloc> Thaw() {
+        if (impl_ == nullptr) {
+            return Vector<T, Alloc>{};
+        }
+        if (impl_.use_count() == 1) {
+            Vector<T, Alloc> result(std::move(*impl_));
+            impl_.reset();
+            return result;
+        }
+        Vector<T, Alloc> result(*impl_);
+        impl_.reset();
+        return result;
+    }
+
+private:
+    std::shared_ptr<Vector<T, Alloc>> impl_;
+};
+
+template <typename T, typename Alloc>
+SharedVector<T, Alloc> Vector<T, Alloc>::Freeze() {
+    return SharedVector<T, Alloc>(std::move(*this));
+}
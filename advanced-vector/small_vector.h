@@ -0,0 +1,199 @@
+#pragma once
+#include "vector.h"
+
+// Вектор с маленьким буфером: первые N элементов хранятся прямо в объекте,
+// куча через RawMemory задействуется только когда элементов становится больше N
+template <typename T, size_t N, typename Alloc = NewDeleteAllocator<T>>
+class SmallVector {
+public:
+    static_assert(N > 0, "SmallVector требует хотя бы один встроенный слот");
+
+    // Перенос встроенных элементов идёт через RelocateData и не бросает,
+    // только когда тип тривиально перемещаем или его move-конструктор noexcept;
+    // для прочих типов перемещение и Swap не могут обещать noexcept
+    static constexpr bool IS_NOTHROW_RELOCATABLE =
+        IsTriviallyRelocatableV<T> || std::is_nothrow_move_constructible_v<T>;
+
+    SmallVector() = default;
+
+    explicit SmallVector(size_t size)
+        : size_(size)
+    {
+        if (size > N) {
+            RawMemory<T, Alloc> new_data(size);
+            data_.Swap(new_data);
+        }
+        std::uninitialized_value_construct_n(Data(), size);
+    }
+
+    SmallVector(const SmallVector& other)
+        : size_(other.size_)
+    {
+        if (other.size_ > N) {
+            RawMemory<T, Alloc> new_data(other.size_, other.data_.GetAllocator());
+            data_.Swap(new_data);
+        }
+        std::uninitialized_copy_n(other.Data(), other.size_, Data());
+    }
+
+    SmallVector(SmallVector&& other) noexcept(IS_NOTHROW_RELOCATABLE) {
+        if (other.IsInline()) {
+            RelocateData(other.Data(), other.size_, Data());
+            DestroyRelocated(other.Data(), other.size_);
+        }
+        else {
+            data_ = std::move(other.data_);
+        }
+        size_ = other.size_;
+        other.size_ = 0;
+    }
+
+    SmallVector& operator=(const SmallVector& rhs) {
+        if (this != &rhs) {
+            SmallVector rhs_copy(rhs);
+            this->Swap(rhs_copy);
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& rhs) noexcept(IS_NOTHROW_RELOCATABLE) {
+        if (this != &rhs) {
+            DestroyData(Data(), size_);
+            size_ = 0;
+            RawMemory<T, Alloc> empty;
+            data_.Swap(empty);
+            if (rhs.IsInline()) {
+                RelocateData(rhs.Data(), rhs.size_, Data());
+                DestroyRelocated(rhs.Data(), rhs.size_);
+            }
+            else {
+                data_ = std::move(rhs.data_);
+            }
+            size_ = rhs.size_;
+            rhs.size_ = 0;
+        }
+        return *this;
+    }
+
+    ~SmallVector() {
+        DestroyData(Data(), size_);
+    }
+
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    iterator begin() noexcept {
+        return Data();
+    }
+
+    iterator end() noexcept {
+        return Data() + size_;
+    }
+
+    const_iterator begin() const noexcept {
+        return Data();
+    }
+
+    const_iterator end() const noexcept {
+        return Data() + size_;
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    size_t Capacity() const noexcept {
+        return IsInline() ? N : data_.Capacity();
+    }
+
+    bool IsInline() const noexcept {
+        return data_.Capacity() == 0;
+    }
+
+    void Reserve(size_t new_capacity) {
+        if (new_capacity <= Capacity()) {
+            return;
+        }
+        RawMemory<T, Alloc> new_data(new_capacity, data_.GetAllocator());
+        RelocateData(Data(), size_, new_data.GetAddress());
+        DestroyRelocated(Data(), size_);
+        data_.Swap(new_data);
+    }
+
+    template <typename... Args>
+    T& EmplaceBack(Args&&... args) {
+        if (size_ == Capacity()) {
+            RawMemory<T, Alloc> new_data(size_ * 2, data_.GetAllocator());
+            new (new_data.GetAddress() + size_) T(std::forward<Args>(args)...);
+            try {
+                RelocateData(Data(), size_, new_data.GetAddress());
+            }
+            catch (...) {
+                // Новый элемент уже построен в свежем буфере — зачищаем,
+                // иначе его деструктор не вызвал бы никто
+                std::destroy_at(new_data.GetAddress() + size_);
+                throw;
+            }
+            DestroyRelocated(Data(), size_);
+            data_.Swap(new_data);
+        }
+        else {
+            new (Data() + size_) T(std::forward<Args>(args)...);
+        }
+        ++size_;
+        return Data()[size_ - 1];
+    }
+
+    template <typename Value>
+    void PushBack(Value&& value) {
+        this->EmplaceBack(std::forward<Value>(value));
+    }
+
+    void PopBack() {
+        std::destroy_at(Data() + size_ - 1);
+        --size_;
+    }
+
+    // Обмен выполняется за O(1) только когда оба вектора в куче;
+    // встроенные элементы переносятся поштучно
+    void Swap(SmallVector& other) noexcept(IS_NOTHROW_RELOCATABLE) {
+        if (!IsInline() && !other.IsInline()) {
+            data_.Swap(other.data_);
+            std::swap(size_, other.size_);
+        }
+        else {
+            SmallVector tmp(std::move(*this));
+            *this = std::move(other);
+            other = std::move(tmp);
+        }
+    }
+
+    const T& operator[](size_t index) const noexcept {
+        return Data()[index];
+    }
+
+    T& operator[](size_t index) noexcept {
+        return Data()[index];
+    }
+
+private:
+    T* Data() noexcept {
+        return IsInline() ? reinterpret_cast<T*>(inline_storage_) : data_.GetAddress();
+    }
+
+    const T* Data() const noexcept {
+        return IsInline() ? reinterpret_cast<const T*>(inline_storage_) : data_.GetAddress();
+    }
+
+    alignas(T) unsigned char inline_storage_[N * sizeof(T)];
+    RawMemory<T, Alloc> data_;
+    size_t size_ = 0;
+};
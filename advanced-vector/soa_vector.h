@@ -0,0 +1,272 @@
+#pragma once
+#include <tuple>
+
+#include "vector.h"
+
+// Контейнер structure-of-arrays: каждое поле записи хранится в собственном
+// непрерывном буфере RawMemory с общими размером и вместимостью. Сканирование
+// одного поля идёт по плотному массиву и не тянет в кэш остальные поля записи
+template <typename... Ts>
+class SoaVector {
+    static_assert(sizeof...(Ts) > 0, "SoaVector требует хотя бы одно поле");
+
+    template <size_t I>
+    using Field = std::tuple_element_t<I, std::tuple<Ts...>>;
+
+    static constexpr size_t NUM_FIELDS = sizeof...(Ts);
+
+public:
+    SoaVector() = default;
+
+    explicit SoaVector(size_t size)
+        : columns_(RawMemory<Ts>(size)...)
+        , size_(size)
+    {
+        size_t constructed = 0;
+        try {
+            ForEachColumn([&](auto& column) {
+                ValueConstructData(column.GetAddress(), size);
+                ++constructed;
+                });
+        }
+        catch (...) {
+            DestroyLeadingColumns(constructed, size);
+            throw;
+        }
+    }
+
+    SoaVector(const SoaVector& other)
+        : columns_(RawMemory<Ts>(other.size_)...)
+        , size_(other.size_)
+    {
+        size_t constructed = 0;
+        try {
+            PairwiseApply(other.columns_, [&](auto& dst, const auto& src) {
+                CopyConstructData(src.GetAddress(), size_, dst.GetAddress());
+                ++constructed;
+                });
+        }
+        catch (...) {
+            DestroyLeadingColumns(constructed, size_);
+            throw;
+        }
+    }
+
+    SoaVector(SoaVector&& other) noexcept
+        : columns_(std::move(other.columns_))
+        , size_(other.size_)
+    {
+        other.size_ = 0;
+    }
+
+    SoaVector& operator=(const SoaVector& rhs) {
+        if (this != &rhs) {
+            SoaVector rhs_copy(rhs);
+            this->Swap(rhs_copy);
+        }
+        return *this;
+    }
+
+    SoaVector& operator=(SoaVector&& rhs) noexcept {
+        if (this != &rhs) {
+            this->Swap(rhs);
+        }
+        return *this;
+    }
+
+    ~SoaVector() {
+        Clear();
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    size_t Capacity() const noexcept {
+        return std::get<0>(columns_).Capacity();
+    }
+
+    // Начало непрерывного буфера поля I — вход для векторизованных проходов
+    template <size_t I>
+    Field<I>* FieldBegin() noexcept {
+        return std::get<I>(columns_).GetAddress();
+    }
+
+    template <size_t I>
+    const Field<I>* FieldBegin() const noexcept {
+        return std::get<I>(columns_).GetAddress();
+    }
+
+    template <size_t I>
+    Field<I>* FieldEnd() noexcept {
+        return FieldBegin<I>() + size_;
+    }
+
+    template <size_t I>
+    const Field<I>* FieldEnd() const noexcept {
+        return FieldBegin<I>() + size_;
+    }
+
+    template <size_t I>
+    Field<I>& Get(size_t index) noexcept {
+        assert(index < size_);
+        return FieldBegin<I>()[index];
+    }
+
+    template <size_t I>
+    const Field<I>& Get(size_t index) const noexcept {
+        assert(index < size_);
+        return FieldBegin<I>()[index];
+    }
+
+    void Reserve(size_t new_capacity) {
+        if (new_capacity <= Capacity()) {
+            return;
+        }
+        Relocate(new_capacity);
+    }
+
+    // Добавляет запись: по одному значению на каждое поле
+    template <typename... Us>
+    void EmplaceBack(Us&&... values) {
+        static_assert(sizeof...(Us) == NUM_FIELDS, "EmplaceBack принимает по одному значению на поле");
+        if (size_ == Capacity()) {
+            GrowAndConstructRow(size_ == 0 ? 1 : size_ * 2,
+                                std::index_sequence_for<Ts...>{}, std::forward<Us>(values)...);
+        }
+        else {
+            ConstructRow(std::index_sequence_for<Ts...>{}, std::forward<Us>(values)...);
+        }
+        ++size_;
+    }
+
+    void PopBack() noexcept {
+        assert(size_ > 0);
+        --size_;
+        ForEachColumn([&](auto& column) {
+            std::destroy_at(column.GetAddress() + size_);
+            });
+    }
+
+    void Clear() noexcept {
+        ForEachColumn([&](auto& column) {
+            DestroyData(column.GetAddress(), size_);
+            });
+        size_ = 0;
+    }
+
+    void Swap(SoaVector& other) noexcept {
+        std::swap(columns_, other.columns_);
+        std::swap(size_, other.size_);
+    }
+
+private:
+    template <typename Fn>
+    void ForEachColumn(Fn fn) {
+        std::apply([&](auto&... columns) {
+            (fn(columns), ...);
+            }, columns_);
+    }
+
+    template <typename Columns, typename Fn>
+    void PairwiseApply(Columns&& other_columns, Fn fn) {
+        PairwiseApplyImpl(std::forward<Columns>(other_columns), fn, std::index_sequence_for<Ts...>{});
+    }
+
+    template <typename Columns, typename Fn, size_t... Is>
+    void PairwiseApplyImpl(Columns&& other_columns, Fn fn, std::index_sequence<Is...>) {
+        (fn(std::get<Is>(columns_), std::get<Is>(other_columns)), ...);
+    }
+
+    // Уничтожает элементы первых num_columns столбцов — откат частично
+    // выполненной операции над несколькими столбцами
+    void DestroyLeadingColumns(size_t num_columns, size_t count) noexcept {
+        size_t index = 0;
+        ForEachColumn([&](auto& column) {
+            if (index++ < num_columns) {
+                DestroyData(column.GetAddress(), count);
+            }
+            });
+    }
+
+    // Переносит все столбцы в свежие буферы вместимостью new_capacity.
+    // Если перенос очередного столбца бросил, уже перенесённые столбцы
+    // зачищаются, а контейнер остаётся в исходном состоянии
+    void Relocate(size_t new_capacity) {
+        std::tuple<RawMemory<Ts>...> new_columns{RawMemory<Ts>(new_capacity)...};
+        size_t relocated = 0;
+        try {
+            PairwiseApply(new_columns, [&](auto& src, auto& dst) {
+                RelocateData(src.GetAddress(), size_, dst.GetAddress());
+                ++relocated;
+                });
+        }
+        catch (...) {
+            size_t index = 0;
+            std::apply([&](auto&... columns) {
+                ((index++ < relocated ? DestroyData(columns.GetAddress(), size_) : void()), ...);
+                }, new_columns);
+            throw;
+        }
+        ForEachColumn([&](auto& column) {
+            DestroyRelocated(column.GetAddress(), size_);
+            });
+        std::swap(columns_, new_columns);
+    }
+
+    // Рост с одновременным добавлением строки: строка строится в свежих
+    // буферах до переноса столбцов и освобождения старых — значения могут
+    // ссылаться на собственные элементы контейнера
+    template <size_t... Is, typename... Us>
+    void GrowAndConstructRow(size_t new_capacity, std::index_sequence<Is...>, Us&&... values) {
+        std::tuple<RawMemory<Ts>...> new_columns{RawMemory<Ts>(new_capacity)...};
+        size_t constructed = 0;
+        try {
+            ((new (std::get<Is>(new_columns).GetAddress() + size_) Field<Is>(std::forward<Us>(values)), ++constructed), ...);
+        }
+        catch (...) {
+            size_t index = 0;
+            std::apply([&](auto&... columns) {
+                ((index++ < constructed ? std::destroy_at(columns.GetAddress() + size_) : void()), ...);
+                }, new_columns);
+            throw;
+        }
+        size_t relocated = 0;
+        try {
+            PairwiseApply(new_columns, [&](auto& src, auto& dst) {
+                RelocateData(src.GetAddress(), size_, dst.GetAddress());
+                ++relocated;
+                });
+        }
+        catch (...) {
+            size_t index = 0;
+            std::apply([&](auto&... columns) {
+                (((index < relocated ? DestroyData(columns.GetAddress(), size_) : void()),
+                  std::destroy_at(columns.GetAddress() + size_), ++index), ...);
+                }, new_columns);
+            throw;
+        }
+        ForEachColumn([&](auto& column) {
+            DestroyRelocated(column.GetAddress(), size_);
+            });
+        std::swap(columns_, new_columns);
+    }
+
+    template <size_t... Is, typename... Us>
+    void ConstructRow(std::index_sequence<Is...>, Us&&... values) {
+        size_t constructed = 0;
+        try {
+            ((new (std::get<Is>(columns_).GetAddress() + size_) Field<Is>(std::forward<Us>(values)), ++constructed), ...);
+        }
+        catch (...) {
+            size_t index = 0;
+            std::apply([&](auto&... columns) {
+                ((index++ < constructed ? std::destroy_at(columns.GetAddress() + size_) : void()), ...);
+                }, columns_);
+            throw;
+        }
+    }
+
+    std::tuple<RawMemory<Ts>...> columns_;
+    size_t size_ = 0;
+};
@@ -0,0 +1,130 @@
+#pragma once
+#include <functional>
+
+#include "vector.h"
+
+// Адаптер над Vector, поддерживающий элементы в отсортированном порядке.
+// Одиночный Insert ставит элемент по lower_bound; пакет InsertBatch
+// дописывается в запас вместимости, сортируется и вливается одним проходом
+// inplace_merge — вместо квадратичного сдвига элементов на каждый Insert.
+// Ленивый режим (SetLazyMergeLimit) копит небольшой неотсортированный хвост
+// и сливает его при первом поиске
+template <typename T, typename Compare = std::less<T>>
+class SortedVector {
+public:
+    using iterator = typename Vector<T>::iterator;
+    using const_iterator = typename Vector<T>::const_iterator;
+
+    SortedVector() = default;
+
+    explicit SortedVector(Compare comp)
+        : comp_(std::move(comp)) {
+    }
+
+    // Включает ленивый режим: до limit вставок складываются в хвост за O(1)
+    // и сливаются при первом поиске; 0 возвращает немедленную вставку
+    void SetLazyMergeLimit(size_t limit) {
+        if (limit == 0) {
+            MergeTail();
+        }
+        lazy_limit_ = limit;
+    }
+
+    size_t Size() const noexcept {
+        return data_.Size();
+    }
+
+    size_t Capacity() const noexcept {
+        return data_.Capacity();
+    }
+
+    void Reserve(size_t new_capacity) {
+        data_.Reserve(new_capacity);
+    }
+
+    template <typename Value>
+    void Insert(Value&& value) {
+        if (lazy_limit_ > 0) {
+            data_.PushBack(std::forward<Value>(value));
+            if (TailSize() >= lazy_limit_) {
+                MergeTail();
+            }
+            return;
+        }
+        const_iterator pos = std::lower_bound(data_.cbegin(), data_.cend(), value, comp_);
+        data_.Insert(pos, std::forward<Value>(value));
+        ++sorted_size_;
+    }
+
+    // Пакетная вставка: дописывает диапазон в хвост, сортирует хвост целиком
+    // и вливает его в отсортированную часть одним inplace_merge
+    template <typename InputIt>
+    void InsertBatch(InputIt first, InputIt last) {
+        data_.AppendRange(first, last);
+        MergeTail();
+    }
+
+    // Досортировывает накопленный хвост; после вызова контейнер целиком
+    // отсортирован. Поисковые методы вызывают его сами
+    void MergeTail() {
+        if (sorted_size_ == data_.Size()) {
+            return;
+        }
+        std::sort(data_.begin() + sorted_size_, data_.end(), comp_);
+        std::inplace_merge(data_.begin(), data_.begin() + sorted_size_, data_.end(), comp_);
+        sorted_size_ = data_.Size();
+    }
+
+    iterator LowerBound(const T& value) {
+        MergeTail();
+        return std::lower_bound(data_.begin(), data_.end(), value, comp_);
+    }
+
+    iterator Find(const T& value) {
+        iterator pos = LowerBound(value);
+        if (pos != data_.end() && !comp_(value, *pos)) {
+            return pos;
+        }
+        return data_.end();
+    }
+
+    bool Contains(const T& value) {
+        return Find(value) != data_.end();
+    }
+
+    bool Erase(const T& value) {
+        iterator pos = Find(value);
+        if (pos == data_.end()) {
+            return false;
+        }
+        data_.Erase(pos);
+        --sorted_size_;
+        return true;
+    }
+
+    // Итерация сливает хвост: обход всегда идёт в отсортированном порядке
+    iterator begin() {
+        MergeTail();
+        return data_.begin();
+    }
+
+    iterator end() {
+        MergeTail();
+        return data_.end();
+    }
+
+    const T& operator[](size_t index) const noexcept {
+        assert(index < sorted_size_);
+        return data_[index];
+    }
+
+private:
+    size_t TailSize() const noexcept {
+        return data_.Size() - sorted_size_;
+    }
+
+    Vector<T> data_;
+    size_t sorted_size_ = 0;
+    size_t lazy_limit_ = 0;
+    Compare comp_{};
+};
@@ -0,0 +1,359 @@
+#include "small_vector.h"
+#include "soa_vector.h"
+#include "vector.h"
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+// Стресс-проверка гарантий исключений: случайные последовательности операций
+// выполняются параллельно над Vector и эталонным std::vector<int>, при этом
+// исключения впрыскиваются и в конструкторы элементов, и в RawMemory::Allocate.
+// После каждого шага сверяются содержимое и счётчик живых объектов.
+// Запуск: g++ -std=c++17 -O1 -fsanitize=address stress_test.cpp && ./a.out [trials]
+
+namespace {
+
+    struct Obj {
+        Obj() {
+            MaybeThrow(default_throw_countdown);
+            ++alive;
+        }
+
+        explicit Obj(int id)
+            : id(id)  //
+        {
+            MaybeThrow(default_throw_countdown);
+            ++alive;
+        }
+
+        // Перемещающих операций нет намеренно: каждый перенос при росте идёт
+        // через копирование и может бросить в самом неудобном месте
+        Obj(const Obj& other)
+            : id(other.id)  //
+        {
+            MaybeThrow(copy_throw_countdown);
+            ++alive;
+        }
+
+        Obj& operator=(const Obj& other) {
+            MaybeThrow(copy_throw_countdown);
+            id = other.id;
+            return *this;
+        }
+
+        ~Obj() {
+            --alive;
+        }
+
+        static void MaybeThrow(int& countdown) {
+            if (countdown > 0 && --countdown == 0) {
+                throw std::runtime_error("Oops");
+            }
+        }
+
+        static inline int default_throw_countdown = 0;
+        static inline int copy_throw_countdown = 0;
+        static inline int alive = 0;
+
+        int id = 0;
+    };
+
+    // Аллокатор с обратным отсчётом до bad_alloc — имитация исчерпания памяти
+    template <typename T>
+    class FaultyAllocator {
+    public:
+        T* Allocate(size_t n) {
+            if (throw_countdown > 0 && --throw_countdown == 0) {
+                throw std::bad_alloc();
+            }
+            return base_.Allocate(n);
+        }
+
+        void Deallocate(T* buf, size_t n) noexcept {
+            base_.Deallocate(buf, n);
+        }
+
+        static inline int throw_countdown = 0;
+
+    private:
+        NewDeleteAllocator<T> base_;
+    };
+
+    using TestVector = Vector<Obj, FaultyAllocator<Obj>>;
+
+    template <typename Container>
+    std::vector<int> Ids(const Container& v) {
+        std::vector<int> result;
+        result.reserve(v.Size());
+        for (const Obj& obj : v) {
+            result.push_back(obj.id);
+        }
+        return result;
+    }
+
+    std::vector<int> SoaIds(const SoaVector<Obj, int>& v) {
+        std::vector<int> result;
+        result.reserve(v.Size());
+        for (size_t i = 0; i < v.Size(); ++i) {
+            result.push_back(v.Get<0>(i).id);
+        }
+        return result;
+    }
+
+    void DisarmFaults() {
+        Obj::default_throw_countdown = 0;
+        Obj::copy_throw_countdown = 0;
+        FaultyAllocator<Obj>::throw_countdown = 0;
+    }
+
+    #define STRESS_ASSERT(cond)                                                  \
+        if (!(cond)) {                                                           \
+            std::cerr << "FAILED: " #cond " (seed " << seed << ", step " << step \
+                      << ", op " << op << ")" << std::endl;                      \
+            std::abort();                                                        \
+        }
+
+    void RunTrial(unsigned seed, size_t num_steps) {
+        std::mt19937 gen(seed);
+        auto rand_int = [&](int bound) {
+            return static_cast<int>(gen() % static_cast<unsigned>(bound));
+        };
+
+        TestVector v;
+        std::vector<int> oracle;
+        TestVector other;
+        std::vector<int> other_oracle;
+        int next_id = 0;
+        int op = -1;
+
+        for (size_t step = 0; step < num_steps; ++step) {
+            op = rand_int(10);
+            // Каждая четвёртая операция выполняется под угрозой исключения
+            if (rand_int(4) == 0) {
+                switch (rand_int(3)) {
+                    case 0: Obj::default_throw_countdown = 1 + rand_int(5); break;
+                    case 1: Obj::copy_throw_countdown = 1 + rand_int(5); break;
+                    case 2: FaultyAllocator<Obj>::throw_countdown = 1 + rand_int(2); break;
+                }
+            }
+
+            std::vector<int> before = Ids(v);
+            // Операции без сильной гарантии меняют вектор на месте:
+            // после исключения эталон синхронизируется по факту
+            bool strong_guarantee = true;
+            try {
+                switch (op) {
+                    case 0:
+                    case 1: {
+                        Obj obj(next_id);
+                        v.PushBack(obj);
+                        oracle.push_back(next_id++);
+                        break;
+                    }
+                    case 2:
+                        v.EmplaceBack(next_id);
+                        oracle.push_back(next_id++);
+                        break;
+                    case 3:
+                        if (v.Size() > 0) {
+                            size_t pos = static_cast<size_t>(rand_int(static_cast<int>(v.Size()) + 1));
+                            // вставка не в конец сдвигает элементы на месте:
+                            // как и у std::vector, гарантия только базовая
+                            strong_guarantee = pos == v.Size();
+                            v.Emplace(v.cbegin() + pos, next_id);
+                            oracle.insert(oracle.begin() + static_cast<long>(pos), next_id++);
+                        }
+                        break;
+                    case 4:
+                        strong_guarantee = false;
+                        if (v.Size() > 0) {
+                            size_t pos = static_cast<size_t>(rand_int(static_cast<int>(v.Size())));
+                            v.Erase(v.cbegin() + pos);
+                            oracle.erase(oracle.begin() + static_cast<long>(pos));
+                        }
+                        break;
+                    case 5:
+                        if (v.Size() > 0) {
+                            v.PopBack();
+                            oracle.pop_back();
+                        }
+                        break;
+                    case 6: {
+                        size_t new_size = static_cast<size_t>(rand_int(40));
+                        v.Resize(new_size);
+                        oracle.resize(new_size, 0);
+                        break;
+                    }
+                    case 7:
+                        v.Reserve(static_cast<size_t>(rand_int(100)));
+                        break;
+                    case 8:
+                        // присваивание при достаточной вместимости идёт
+                        // поэлементно — это базовая гарантия, не сильная
+                        strong_guarantee = false;
+                        v = other;
+                        oracle = other_oracle;
+                        break;
+                    case 9:
+                        strong_guarantee = false;
+                        other = v;
+                        other_oracle = oracle;
+                        break;
+                }
+            }
+            catch (const std::exception&) {
+                DisarmFaults();
+                if (strong_guarantee) {
+                    STRESS_ASSERT(Ids(v) == before);
+                }
+                else {
+                    oracle = Ids(v);
+                    other_oracle = Ids(other);
+                }
+            }
+            DisarmFaults();
+
+            STRESS_ASSERT(Ids(v) == oracle);
+            STRESS_ASSERT(Ids(other) == other_oracle);
+            STRESS_ASSERT(Obj::alive == static_cast<int>(v.Size() + other.Size()));
+        }
+    }
+
+    // SmallVector дублирует механику роста Vector своим кодом —
+    // прогоняется под теми же впрысками
+    void RunSmallTrial(unsigned seed, size_t num_steps) {
+        std::mt19937 gen(seed);
+        auto rand_int = [&](int bound) {
+            return static_cast<int>(gen() % static_cast<unsigned>(bound));
+        };
+
+        SmallVector<Obj, 4, FaultyAllocator<Obj>> v;
+        std::vector<int> oracle;
+        int next_id = 0;
+        int op = -1;
+
+        for (size_t step = 0; step < num_steps; ++step) {
+            op = rand_int(5);
+            if (rand_int(4) == 0) {
+                switch (rand_int(3)) {
+                    case 0: Obj::default_throw_countdown = 1 + rand_int(5); break;
+                    case 1: Obj::copy_throw_countdown = 1 + rand_int(5); break;
+                    case 2: FaultyAllocator<Obj>::throw_countdown = 1 + rand_int(2); break;
+                }
+            }
+
+            std::vector<int> before = Ids(v);
+            try {
+                switch (op) {
+                    case 0:
+                    case 1:
+                        v.EmplaceBack(next_id);
+                        oracle.push_back(next_id++);
+                        break;
+                    case 2: {
+                        Obj obj(next_id);
+                        v.PushBack(obj);
+                        oracle.push_back(next_id++);
+                        break;
+                    }
+                    case 3:
+                        if (v.Size() > 0) {
+                            v.PopBack();
+                            oracle.pop_back();
+                        }
+                        break;
+                    case 4:
+                        v.Reserve(static_cast<size_t>(rand_int(40)));
+                        break;
+                }
+            }
+            catch (const std::exception&) {
+                DisarmFaults();
+                STRESS_ASSERT(Ids(v) == before);
+            }
+            DisarmFaults();
+
+            STRESS_ASSERT(Ids(v) == oracle);
+            STRESS_ASSERT(Obj::alive == static_cast<int>(v.Size()));
+        }
+    }
+
+    // SoaVector тоже растёт собственным кодом; эталон следит за первым полем,
+    // счётчик живых Obj — за утечками в любом столбце
+    void RunSoaTrial(unsigned seed, size_t num_steps) {
+        std::mt19937 gen(seed);
+        auto rand_int = [&](int bound) {
+            return static_cast<int>(gen() % static_cast<unsigned>(bound));
+        };
+
+        SoaVector<Obj, int> v;
+        std::vector<int> oracle;
+        int next_id = 0;
+        int op = -1;
+
+        for (size_t step = 0; step < num_steps; ++step) {
+            op = rand_int(6);
+            if (rand_int(4) == 0) {
+                switch (rand_int(2)) {
+                    case 0: Obj::default_throw_countdown = 1 + rand_int(5); break;
+                    case 1: Obj::copy_throw_countdown = 1 + rand_int(5); break;
+                }
+            }
+
+            std::vector<int> before = SoaIds(v);
+            try {
+                switch (op) {
+                    case 0:
+                    case 1:
+                    case 2:
+                        v.EmplaceBack(next_id, next_id);
+                        oracle.push_back(next_id++);
+                        break;
+                    case 3:
+                        if (v.Size() > 0) {
+                            v.PopBack();
+                            oracle.pop_back();
+                        }
+                        break;
+                    case 4:
+                        v.Reserve(static_cast<size_t>(rand_int(40)));
+                        break;
+                    case 5: {
+                        SoaVector<Obj, int> copy(v);
+                        STRESS_ASSERT(SoaIds(copy) == oracle);
+                        break;
+                    }
+                }
+            }
+            catch (const std::exception&) {
+                DisarmFaults();
+                STRESS_ASSERT(SoaIds(v) == before);
+            }
+            DisarmFaults();
+
+            STRESS_ASSERT(SoaIds(v) == oracle);
+            STRESS_ASSERT(Obj::alive == static_cast<int>(v.Size()));
+            for (size_t i = 0; i < v.Size(); ++i) {
+                STRESS_ASSERT(v.Get<0>(i).id == v.Get<1>(i));
+            }
+        }
+    }
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    unsigned num_trials = argc > 1 ? static_cast<unsigned>(std::stoul(argv[1])) : 200;
+    for (unsigned seed = 0; seed < num_trials; ++seed) {
+        RunTrial(seed, 300);
+        RunSmallTrial(seed, 300);
+        RunSoaTrial(seed, 300);
+        if (Obj::alive != 0) {
+            std::cerr << "FAILED: leaked " << Obj::alive << " objects (seed " << seed << ")" << std::endl;
+            return 1;
+        }
+    }
+    std::cout << num_trials << " trials OK" << std::endl;
+}
@@ -1,114 +1,484 @@
 #pragma once
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstdlib>
+#include <cstring>
+#include <iterator>
 #include <new>
+#include <thread>
+#include <type_traits>
 #include <utility>
 #include <memory>
 
+#include "allocators.h"
+
+// Опциональный учёт аллокаций и реаллокаций (см. vector_stats.h);
+// без -DADVANCED_VECTOR_STATS хуки раскрываются в пустоту
+#ifdef ADVANCED_VECTOR_STATS
+#include "vector_stats.h"
+#define ADVANCED_VECTOR_STATS_HOOK(...) __VA_ARGS__
+#else
+#define ADVANCED_VECTOR_STATS_HOOK(...)
+#endif
+
+// Работа Vector в constexpr-контексте требует C++20: constexpr-аллокаций
+// (std::allocator), std::construct_at и std::is_constant_evaluated
+#if defined(__cpp_lib_constexpr_dynamic_alloc) && defined(__cpp_lib_is_constant_evaluated)
+#define ADVANCED_VECTOR_HAS_CONSTEXPR 1
+#define ADVANCED_VECTOR_CONSTEXPR constexpr
+#else
+#define ADVANCED_VECTOR_HAS_CONSTEXPR 0
+#define ADVANCED_VECTOR_CONSTEXPR
+#endif
+
+// Конструирует объект по адресу ptr; в constexpr-контексте placement new
+// недоступен, поэтому используется std::construct_at
+template <typename T, typename... Args>
+ADVANCED_VECTOR_CONSTEXPR T* ConstructAt(T* ptr, Args&&... args) {
+#if ADVANCED_VECTOR_HAS_CONSTEXPR
+    return std::construct_at(ptr, std::forward<Args>(args)...);
+#else
+    return new (ptr) T(std::forward<Args>(args)...);
+#endif
+}
+
+// Признак тривиальной перемещаемости (семантика P1144): объект можно перенести
+// на новое место побайтово и не вызывать деструктор исходника. Выводится
+// автоматически для тривиально копируемых типов; пользователи могут
+// специализировать для своих типов (записи с unique_ptr, маленькие строки)
+template <typename T>
+struct IsTriviallyRelocatable : std::is_trivially_copyable<T> {};
+
+template <typename T>
+inline constexpr bool IsTriviallyRelocatableV = IsTriviallyRelocatable<T>::value;
+
+// Переносит count элементов из from в to наиболее дешёвым способом:
+// для тривиально перемещаемых типов — одним memcpy, иначе — перемещением,
+// а если перемещение может бросить исключение — копированием
+template <typename T>
+ADVANCED_VECTOR_CONSTEXPR void RelocateData(T* from, size_t count, T* to) {
+#if ADVANCED_VECTOR_HAS_CONSTEXPR
+    if (std::is_constant_evaluated()) {
+        for (size_t i = 0; i != count; ++i) {
+            std::construct_at(to + i, std::move(from[i]));
+        }
+        return;
+    }
+#endif
+    if constexpr (IsTriviallyRelocatableV<T>) {
+        if (count != 0) {
+            std::memcpy(to, from, count * sizeof(T));
+        }
+    }
+    else if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+        std::uninitialized_move_n(from, count, to);
+    }
+    else {
+        std::uninitialized_copy_n(from, count, to);
+    }
+}
+
+
+// Копирует count элементов из from в неинициализированную память to
 template <typename T>
+ADVANCED_VECTOR_CONSTEXPR void CopyConstructData(const T* from, size_t count, T* to) {
+#if ADVANCED_VECTOR_HAS_CONSTEXPR
+    if (std::is_constant_evaluated()) {
+        for (size_t i = 0; i != count; ++i) {
+            std::construct_at(to + i, from[i]);
+        }
+        return;
+    }
+#endif
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        if (count != 0) {
+            std::memcpy(to, from, count * sizeof(T));
+        }
+    }
+    else {
+        std::uninitialized_copy_n(from, count, to);
+    }
+}
+
+// Конструирует count значений по умолчанию начиная с from
+template <typename T>
+ADVANCED_VECTOR_CONSTEXPR void ValueConstructData(T* from, size_t count) {
+#if ADVANCED_VECTOR_HAS_CONSTEXPR
+    if (std::is_constant_evaluated()) {
+        for (size_t i = 0; i != count; ++i) {
+            std::construct_at(from + i);
+        }
+        return;
+    }
+#endif
+    std::uninitialized_value_construct_n(from, count);
+}
+
+// Разрушает count элементов начиная с from; для тривиально разрушаемых типов не делает ничего
+template <typename T>
+ADVANCED_VECTOR_CONSTEXPR void DestroyData(T* from, size_t count) noexcept {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        std::destroy_n(from, count);
+    }
+}
+
+// Разрушает count исходных элементов после RelocateData. Для тривиально
+// перемещаемых типов содержимое уже «переехало» побайтово, и деструкторы
+// исходников вызывать нельзя — это был бы двойной возврат ресурсов
+template <typename T>
+ADVANCED_VECTOR_CONSTEXPR void DestroyRelocated(T* from, size_t count) noexcept {
+#if ADVANCED_VECTOR_HAS_CONSTEXPR
+    if (std::is_constant_evaluated()) {
+        // В constexpr-контексте RelocateData перемещает, а не копирует байты
+        std::destroy_n(from, count);
+        return;
+    }
+#endif
+    if constexpr (!IsTriviallyRelocatableV<T>) {
+        DestroyData(from, count);
+    }
+    else {
+        (void)from;
+        (void)count;
+    }
+}
+
+// Делит диапазон [from, from + count) между num_threads потоками и выполняет
+// op(ptr, n) над каждой частью; последняя часть обрабатывается текущим потоком
+template <typename T, typename Op>
+void ParallelPartition(T* from, size_t count, unsigned num_threads, Op op) {
+    num_threads = std::max(1u, std::min<unsigned>(num_threads, static_cast<unsigned>(count)));
+    if (num_threads == 1) {
+        op(from, count);
+        return;
+    }
+    size_t chunk = count / num_threads;
+    auto workers = std::make_unique<std::thread[]>(num_threads - 1);
+    for (unsigned i = 0; i + 1 < num_threads; ++i) {
+        workers[i] = std::thread(op, from + chunk * i, chunk);
+    }
+    op(from + chunk * (num_threads - 1), count - chunk * (num_threads - 1));
+    for (unsigned i = 0; i + 1 < num_threads; ++i) {
+        workers[i].join();
+    }
+}
+
+// Конструирует count значений по умолчанию в num_threads потоков.
+// Типы с бросающим конструктором заполняются в один поток: откат частично
+// сконструированных чужими потоками элементов не поддерживается
+template <typename T>
+void ParallelValueConstruct(T* from, size_t count, unsigned num_threads) {
+    if constexpr (std::is_nothrow_default_constructible_v<T>) {
+        ParallelPartition(from, count, num_threads, [](T* ptr, size_t n) {
+            std::uninitialized_value_construct_n(ptr, n);
+            });
+    }
+    else {
+        std::uninitialized_value_construct_n(from, count);
+    }
+}
+
+// Разрушает count элементов в num_threads потоков;
+// для тривиально разрушаемых типов не делает ничего
+template <typename T>
+void ParallelDestroy(T* from, size_t count, unsigned num_threads) noexcept {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        ParallelPartition(from, count, num_threads, [](T* ptr, size_t n) {
+            std::destroy_n(ptr, n);
+            });
+    }
+}
+
+// Определяет, умеет ли аллокатор менять размер существующего блока
+// (Reallocate(buf, old_n, new_n), как у MallocAllocator)
+template <typename Alloc, typename T, typename = void>
+struct HasReallocate : std::false_type {};
+
+template <typename Alloc, typename T>
+struct HasReallocate<Alloc, T,
+    std::void_t<decltype(std::declval<Alloc&>().Reallocate(std::declval<T*>(), size_t{}, size_t{}))>>
+    : std::true_type {};
+
+// Определяет, задаёт ли аллокатор собственное округление ёмкости
+// (AdjustCapacity(n), как у AlignedAllocator)
+template <typename Alloc, typename = void>
+struct HasAdjustCapacity : std::false_type {};
+
+template <typename Alloc>
+struct HasAdjustCapacity<Alloc,
+    std::void_t<decltype(std::declval<const Alloc&>().AdjustCapacity(size_t{}))>>
+    : std::true_type {};
+
+// Определяет, сообщает ли диапазон свой размер через std::size —
+// подсказка для предварительного выделения при материализации
+template <typename Range, typename = void>
+struct HasRangeSize : std::false_type {};
+
+template <typename Range>
+struct HasRangeSize<Range,
+    std::void_t<decltype(std::size(std::declval<Range&>()))>>
+    : std::true_type {};
+
+template <typename T, typename Alloc = NewDeleteAllocator<T>>
 class RawMemory {
 public:
-    RawMemory() = default;
+    // Вызывается вместо аллокатора при освобождении принятого извне буфера
+    using Deleter = void (*)(T* buf, size_t capacity);
+
+    constexpr RawMemory() = default;
+
+    ADVANCED_VECTOR_CONSTEXPR explicit RawMemory(size_t capacity, const Alloc& alloc = Alloc())
+        : alloc_(alloc)
+        , capacity_(AdjustedCapacity(capacity))
+        , buffer_(Allocate(capacity_)) {
+    }
 
-    explicit RawMemory(size_t capacity)
-        : buffer_(Allocate(capacity))
-        , capacity_(capacity) {
+    // Принимает во владение внешний буфер ёмкостью capacity элементов.
+    // При освобождении будет вызван deleter; nullptr означает, что буфером
+    // владеет кто-то другой и освобождать его не нужно
+    RawMemory(T* buf, size_t capacity, Deleter deleter) noexcept
+        : capacity_(capacity)
+        , buffer_(buf)
+        , deleter_(deleter)
+        , adopted_(true) {
     }
 
     RawMemory(const RawMemory&) = delete;
     RawMemory& operator=(const RawMemory& rhs) = delete;
 
-    RawMemory(RawMemory&& other) noexcept
+    ADVANCED_VECTOR_CONSTEXPR RawMemory(RawMemory&& other) noexcept
     {
         this->Swap(other);
     }
 
-    RawMemory& operator=(RawMemory&& rhs) noexcept {
+    ADVANCED_VECTOR_CONSTEXPR RawMemory& operator=(RawMemory&& rhs) noexcept {
         if (this != &rhs) {
             this->Swap(rhs);
         }
         return *this;
     }
     
-    ~RawMemory() {
+    ADVANCED_VECTOR_CONSTEXPR ~RawMemory() {
         Deallocate(buffer_);
     }
 
-    T* operator+(size_t offset) noexcept {
+    ADVANCED_VECTOR_CONSTEXPR T* operator+(size_t offset) noexcept {
         // Разрешается получать адрес ячейки памяти, следующей за последним элементом массива
         assert(offset <= capacity_);
         return buffer_ + offset;
     }
 
-    const T* operator+(size_t offset) const noexcept {
+    ADVANCED_VECTOR_CONSTEXPR const T* operator+(size_t offset) const noexcept {
         return const_cast<RawMemory&>(*this) + offset;
     }
 
-    const T& operator[](size_t index) const noexcept {
+    ADVANCED_VECTOR_CONSTEXPR const T& operator[](size_t index) const noexcept {
         return const_cast<RawMemory&>(*this)[index];
     }
 
-    T& operator[](size_t index) noexcept {
+    ADVANCED_VECTOR_CONSTEXPR T& operator[](size_t index) noexcept {
         assert(index < capacity_);
         return buffer_[index];
     }
 
-    void Swap(RawMemory& other) noexcept {
+    ADVANCED_VECTOR_CONSTEXPR void Swap(RawMemory& other) noexcept {
+        std::swap(alloc_, other.alloc_);
         std::swap(buffer_, other.buffer_);
         std::swap(capacity_, other.capacity_);
+        std::swap(deleter_, other.deleter_);
+        std::swap(adopted_, other.adopted_);
     }
 
-    const T* GetAddress() const noexcept {
+    ADVANCED_VECTOR_CONSTEXPR const T* GetAddress() const noexcept {
         return buffer_;
     }
 
-    T* GetAddress() noexcept {
+    ADVANCED_VECTOR_CONSTEXPR T* GetAddress() noexcept {
         return buffer_;
     }
 
-    size_t Capacity() const {
+    ADVANCED_VECTOR_CONSTEXPR size_t Capacity() const {
         return capacity_;
     }
 
+    ADVANCED_VECTOR_CONSTEXPR const Alloc& GetAllocator() const noexcept {
+        return alloc_;
+    }
+
+    // Пытается нарастить блок до new_capacity, сохранив содержимое на месте
+    // (или перенеся его средствами аллокатора). Возможно только когда аллокатор
+    // умеет Reallocate; вызывающий отвечает за тривиальную копируемость T
+    ADVANCED_VECTOR_CONSTEXPR bool TryGrow(size_t new_capacity) {
+        if constexpr (HasReallocate<Alloc, T>::value) {
+            if (adopted_) {
+                // Принятый извне буфер не принадлежит аллокатору
+                return false;
+            }
+            ADVANCED_VECTOR_STATS_HOOK(bool was_empty = buffer_ == nullptr;)
+            buffer_ = alloc_.Reallocate(buffer_, capacity_, new_capacity);
+            ADVANCED_VECTOR_STATS_HOOK(
+                VectorStats& stats = ThreadVectorStats();
+                // Рост из realloc(nullptr) — первое выделение, иначе реаллокация;
+                // учитывается прирост, чтобы Deallocate итоговой ёмкости сошёлся
+                if (was_empty) {
+                    stats.allocations += 1;
+                }
+                else {
+                    stats.reallocations += 1;
+                }
+                stats.bytes_allocated += (new_capacity - capacity_) * sizeof(T);
+                stats.current_bytes += (new_capacity - capacity_) * sizeof(T);
+                stats.peak_bytes = std::max(stats.peak_bytes, stats.current_bytes);
+            )
+            capacity_ = new_capacity;
+            return true;
+        }
+        else {
+            (void)new_capacity;
+            return false;
+        }
+    }
+
 private:
-    // Выделяет сырую память под n элементов и возвращает указатель на неё
-    static T* Allocate(size_t n) {
-        return n != 0 ? static_cast<T*>(operator new(n * sizeof(T))) : nullptr;
+    // Выделяет сырую память под n элементов и возвращает указатель на неё;
+    // в constexpr-контексте память берётся у std::allocator
+    ADVANCED_VECTOR_CONSTEXPR T* Allocate(size_t n) {
+#if ADVANCED_VECTOR_HAS_CONSTEXPR
+        if (std::is_constant_evaluated()) {
+            return n != 0 ? std::allocator<T>{}.allocate(n) : nullptr;
+        }
+#endif
+        T* buf = alloc_.Allocate(n);
+        ADVANCED_VECTOR_STATS_HOOK(
+            VectorStats& stats = ThreadVectorStats();
+            stats.allocations += 1;
+            stats.bytes_allocated += n * sizeof(T);
+            stats.current_bytes += n * sizeof(T);
+            stats.peak_bytes = std::max(stats.peak_bytes, stats.current_bytes);
+        )
+        return buf;
     }
 
     // Освобождает сырую память, выделенную ранее по адресу buf при помощи Allocate
-    static void Deallocate(T* buf) noexcept {
-        operator delete(buf);
+    ADVANCED_VECTOR_CONSTEXPR void Deallocate(T* buf) noexcept {
+#if ADVANCED_VECTOR_HAS_CONSTEXPR
+        if (std::is_constant_evaluated()) {
+            if (buf != nullptr) {
+                std::allocator<T>{}.deallocate(buf, capacity_);
+            }
+            return;
+        }
+#endif
+        if (adopted_) {
+            if (deleter_ != nullptr) {
+                deleter_(buf, capacity_);
+            }
+            return;
+        }
+        ADVANCED_VECTOR_STATS_HOOK(
+            if (buf != nullptr) {
+                VectorStats& stats = ThreadVectorStats();
+                stats.deallocations += 1;
+                stats.current_bytes -= capacity_ * sizeof(T);
+            }
+        )
+        alloc_.Deallocate(buf, capacity_);
     }
 
-    T* buffer_ = nullptr;
+    // Ёмкость c учётом округления аллокатором; объявлена раньше buffer_,
+    // чтобы Allocate в конструкторе видел уже скорректированное значение
+    ADVANCED_VECTOR_CONSTEXPR size_t AdjustedCapacity(size_t n) const {
+#if ADVANCED_VECTOR_HAS_CONSTEXPR
+        if (std::is_constant_evaluated()) {
+            return n;
+        }
+#endif
+        if constexpr (HasAdjustCapacity<Alloc>::value) {
+            return alloc_.AdjustCapacity(n);
+        }
+        else {
+            return n;
+        }
+    }
+
+    Alloc alloc_{};
     size_t capacity_ = 0;
+    T* buffer_ = nullptr;
+    Deleter deleter_ = nullptr;
+    bool adopted_ = false;
 };
 
+template <typename T, typename Alloc = NewDeleteAllocator<T>>
+class Vector;
+
+template <typename T, typename Alloc>
+class SharedVector;
+
+// Vector с буфером, выровненным на Align байт, — для SIMD-ядер,
+// рассчитывающих на выровненные загрузки без скалярных прологов
+template <typename T, size_t Align>
+using AlignedVector = Vector<T, AlignedAllocator<T, Align>>;
+
+#if defined(__unix__) || defined(__APPLE__)
+// Vector на крупных страницах — для буферов в десятки гигабайт,
+// где обычные 4К-страницы упираются в TLB
+template <typename T>
+using HugePageVector = Vector<T, HugePageAllocator<T>>;
+#endif
+
+// Vector с переиспользованием буферов через потоколокальный пул — для
+// сценария «тысячи короткоживущих векторов похожих размеров на запрос».
+// В паузах пул сбрасывается вызовом ThreadLocalPoolAllocator<T>::TrimPools
 template <typename T>
+using PooledVector = Vector<T, ThreadLocalPoolAllocator<T>>;
+
+template <typename T, typename Alloc>
 class Vector {
 public:
 
-    Vector() = default;
+    // Стратегия роста ёмкости при нехватке места
+    enum class GrowthPolicy {
+        Double,          // удвоение ёмкости (по умолчанию)
+        Golden,          // рост в полтора раза — освобождённые блоки пригодны для переиспользования
+        FixedIncrement,  // рост на фиксированное число элементов, задаётся в SetGrowthPolicy
+        PageRounded,     // удвоение с округлением ёмкости вверх до границы страницы
+    };
+
+    constexpr Vector() = default;
 
-    explicit Vector(size_t size)
-        : data_(size)
+    ADVANCED_VECTOR_CONSTEXPR explicit Vector(const Alloc& alloc)
+        : data_(0, alloc) {
+    }
+
+    ADVANCED_VECTOR_CONSTEXPR explicit Vector(size_t size, const Alloc& alloc = Alloc())
+        : data_(size, alloc)
         , size_(size)  //
     {
-        std::uninitialized_value_construct_n(data_.GetAddress(), size);
+        ValueConstructData(data_.GetAddress(), size);
     }
 
-    Vector(const Vector& other)
-        : data_(other.Size())
+    // Конструирует size элементов, разбивая заполнение между num_threads потоками
+    Vector(size_t size, unsigned num_threads, const Alloc& alloc = Alloc())
+        : data_(size, alloc)
+        , size_(size)  //
+    {
+        ParallelValueConstruct(data_.GetAddress(), size, num_threads);
+    }
+
+    ADVANCED_VECTOR_CONSTEXPR Vector(const Vector& other)
+        : data_(other.Size(), other.data_.GetAllocator())
     {
         size_t new_size = other.Size();
-        std::uninitialized_copy_n(other.data_.GetAddress(), new_size, data_.GetAddress());
+        CopyConstructData(other.data_.GetAddress(), new_size, data_.GetAddress());
         size_ = new_size;
     }
 
-    Vector(Vector&& other) noexcept
+    ADVANCED_VECTOR_CONSTEXPR Vector(Vector&& other) noexcept
         : data_(std::move(other.data_))
         , size_(other.size_)
+        , growth_(other.growth_)
+        , growth_increment_(other.growth_increment_)
     {
         other.size_ = 0;
     }
@@ -118,6 +488,10 @@ public:
             if (rhs.size_ > data_.Capacity()) {
                 Vector rhs_copy(rhs);
                 Swap(rhs_copy);
+                // Swap обменял и стратегию роста с временной копией;
+                // присваивание копирует содержимое, а не настройки приёмника
+                growth_ = rhs_copy.growth_;
+                growth_increment_ = rhs_copy.growth_increment_;
             }
             else {
                 size_t copy_count = std::min(rhs.size_, size_);
@@ -140,14 +514,14 @@ public:
         return *this;
     }
 
-    Vector& operator=(Vector&& rhs) noexcept {
+    ADVANCED_VECTOR_CONSTEXPR Vector& operator=(Vector&& rhs) noexcept {
         if (this != &rhs) {
             this->Swap(rhs);
         }
         return *this;
     }
 
-    ~Vector() {
+    ADVANCED_VECTOR_CONSTEXPR ~Vector() {
         std::destroy_n(data_.GetAddress(), size_);
         size_ = 0;
     }
@@ -155,36 +529,36 @@ public:
     using iterator = T*;
     using const_iterator = const T*;
 
-    iterator begin() noexcept {
+    ADVANCED_VECTOR_CONSTEXPR iterator begin() noexcept {
         return data_.GetAddress();
     }
 
-    iterator end() noexcept {
+    ADVANCED_VECTOR_CONSTEXPR iterator end() noexcept {
         return data_.GetAddress() + size_;
     }
 
-    const_iterator begin() const noexcept {
+    ADVANCED_VECTOR_CONSTEXPR const_iterator begin() const noexcept {
         return data_.GetAddress();
     }
 
-    const_iterator end() const noexcept {
+    ADVANCED_VECTOR_CONSTEXPR const_iterator end() const noexcept {
         return data_.GetAddress() + size_;
     }
 
-    const_iterator cbegin() const noexcept {
+    ADVANCED_VECTOR_CONSTEXPR const_iterator cbegin() const noexcept {
         return data_.GetAddress();
     }
 
-    const_iterator cend() const noexcept {
+    ADVANCED_VECTOR_CONSTEXPR const_iterator cend() const noexcept {
         return data_.GetAddress() + size_;
     }
 
-    void Resize(size_t new_size) {
+    ADVANCED_VECTOR_CONSTEXPR void Resize(size_t new_size) {
         if (new_size > size_) {
             if (new_size > data_.Capacity()) {
                 this->Reserve(new_size);
             }
-            std::uninitialized_value_construct_n(data_.GetAddress() + size_, new_size - size_);
+            ValueConstructData(data_.GetAddress() + size_, new_size - size_);
         }
         else {
             std::destroy_n(data_.GetAddress() + new_size, size_ - new_size);
@@ -192,32 +566,130 @@ public:
         size_ = new_size;
     }
 
+    // Вариант Resize, конструирующий и разрушающий элементы в num_threads потоков.
+    // Деструктор вектора намеренно остаётся однопоточным: неявный запуск потоков
+    // при разрушении объекта был бы сюрпризом для вызывающего
+    void Resize(size_t new_size, unsigned num_threads) {
+        if (new_size > size_) {
+            if (new_size > data_.Capacity()) {
+                this->Reserve(new_size);
+            }
+            ParallelValueConstruct(data_.GetAddress() + size_, new_size - size_, num_threads);
+        }
+        else {
+            ParallelDestroy(data_.GetAddress() + new_size, size_ - new_size, num_threads);
+        }
+        size_ = new_size;
+    }
+
+    // Разрушает все элементы в num_threads потоков, сохраняя буфер
+    void ClearParallel(unsigned num_threads) noexcept {
+        ParallelDestroy(data_.GetAddress(), size_, num_threads);
+        size_ = 0;
+    }
+
+    // Меняет размер, не инициализируя новые элементы, — им не выполняется даже
+    // обнуление, поэтому они обязаны быть перезаписаны до первого чтения.
+    // Применимо только к типам без конструктора и деструктора
+    void ResizeUninitialized(size_t new_size) {
+        static_assert(std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>,
+            "ResizeUninitialized applies only to trivial types");
+        if (new_size > data_.Capacity()) {
+            this->Reserve(new_size);
+        }
+        size_ = new_size;
+    }
+
+    // Аналог resize_and_overwrite из P1072: op получает указатель на буфер и
+    // доступное число элементов new_size, заполняет не более new_size элементов
+    // и возвращает фактический размер вектора
+    template <typename Op>
+    void ResizeAndOverwrite(size_t new_size, Op op) {
+        static_assert(std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>,
+            "ResizeAndOverwrite applies only to trivial types");
+        if (new_size > data_.Capacity()) {
+            this->Reserve(new_size);
+        }
+        size_ = op(data_.GetAddress(), new_size);
+        assert(size_ <= new_size);
+    }
+
     template <typename... Args>
-    T& EmplaceBack(Args&&... args) {
+    ADVANCED_VECTOR_CONSTEXPR T& EmplaceBack(Args&&... args) {
         if (size_ == Capacity()) {
-            RawMemory<T> new_data(size_ == 0 ? 1 : size_ * 2);
-            new (new_data.GetAddress() + size_) T(std::forward<Args>(args)...);
-            if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
-                std::uninitialized_move_n(data_.GetAddress(), size_, new_data.GetAddress());
+            if constexpr (std::is_trivially_copyable_v<T> && HasReallocate<Alloc, T>::value) {
+                // Значение материализуется до роста: realloc может переместить буфер
+                // и обесценить ссылки на собственные элементы вектора в args
+                T tmp(std::forward<Args>(args)...);
+                if (data_.TryGrow(CalculateGrowth(size_ + 1))) {
+                    ConstructAt(data_.GetAddress() + size_, std::move(tmp));
+                }
+                else {
+                    // TryGrow отказывает, например, для принятого извне буфера —
+                    // растём обычным переносом в свежий буфер
+                    RawMemory<T, Alloc> new_data(CalculateGrowth(size_ + 1), data_.GetAllocator());
+                    ADVANCED_VECTOR_STATS_HOOK(
+                        ThreadVectorStats().reallocations += 1;
+                        ThreadVectorStats().bytes_relocated += size_ * sizeof(T);
+                    )
+                    ConstructAt(new_data.GetAddress() + size_, std::move(tmp));
+                    RelocateData(data_.GetAddress(), size_, new_data.GetAddress());
+                    DestroyRelocated(data_.GetAddress(), size_);
+                    data_.Swap(new_data);
+                }
             }
             else {
-                std::uninitialized_copy_n(data_.GetAddress(), size_, new_data.GetAddress());
+                RawMemory<T, Alloc> new_data(CalculateGrowth(size_ + 1), data_.GetAllocator());
+                ADVANCED_VECTOR_STATS_HOOK(
+                    ThreadVectorStats().reallocations += 1;
+                    ThreadVectorStats().bytes_relocated += size_ * sizeof(T);
+                )
+                ConstructAt(new_data.GetAddress() + size_, std::forward<Args>(args)...);
+                try {
+                    RelocateData(data_.GetAddress(), size_, new_data.GetAddress());
+                }
+                catch (...) {
+                    // Новый элемент уже построен в свежем буфере — зачищаем,
+                    // иначе его деструктор не вызвал бы никто
+                    std::destroy_at(new_data.GetAddress() + size_);
+                    throw;
+                }
+                DestroyRelocated(data_.GetAddress(), size_);
+                data_.Swap(new_data);
             }
-            std::destroy_n(data_.GetAddress(), size_);
-            data_.Swap(new_data);
         }
         else {
-            new (data_.GetAddress() + size_) T(std::forward<Args>(args)...);
+            ConstructAt(data_.GetAddress() + size_, std::forward<Args>(args)...);
         }
         ++size_;
         return data_[size_ - 1];
     }
 
     template <typename Value>
-    void PushBack(Value&& value) {
+    ADVANCED_VECTOR_CONSTEXPR void PushBack(Value&& value) {
         this->EmplaceBack(std::forward<Value>(value));
     }
 
+    // Гарантирует запас вместимости под count дополнительных элементов.
+    // В отличие от Reserve растёт геометрически, поэтому серия пакетов
+    // ReserveFor + EmplaceBackUnchecked не вырождается в линейные переносы
+    ADVANCED_VECTOR_CONSTEXPR void ReserveFor(size_t count) {
+        if (size_ + count > data_.Capacity()) {
+            this->Reserve(CalculateGrowth(size_ + count));
+        }
+    }
+
+    // Добавление без проверки вместимости: вызывающий обязан заранее
+    // обеспечить место через ReserveFor. Выносит ветвление по вместимости
+    // из горячего цикла — остаётся только конструирование и инкремент
+    template <typename... Args>
+    ADVANCED_VECTOR_CONSTEXPR T& EmplaceBackUnchecked(Args&&... args) {
+        assert(size_ < data_.Capacity());
+        T* result = ConstructAt(data_.GetAddress() + size_, std::forward<Args>(args)...);
+        ++size_;
+        return *result;
+    }
+
     template <typename... Args>
     iterator Emplace(const_iterator pos, Args&&... args) {
         if (pos == end()) {
@@ -225,9 +697,19 @@ public:
         }
         size_t position = static_cast<size_t>(pos - begin());
         if (size_ == Capacity()) {
-            RawMemory<T> new_data(size_ == 0 ? 1 : size_ * 2);
+            RawMemory<T, Alloc> new_data(CalculateGrowth(size_ + 1), data_.GetAllocator());
             new (new_data.GetAddress() + position) T(std::forward<Args>(args)...);
-            if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+            if constexpr (IsTriviallyRelocatableV<T>) {
+                RelocateData(data_.GetAddress(), position, new_data.GetAddress());
+                RelocateData(data_.GetAddress() + position, size_ - position, new_data.GetAddress() + position + 1);
+            }
+            else if constexpr (std::is_nothrow_move_constructible_v<T>) {
+                // Перемещения не бросают — страховочные try/catch не нужны,
+                // ветка компилируется в линейный код без EH-каркаса
+                std::uninitialized_move_n(data_.GetAddress(), position, new_data.GetAddress());
+                std::uninitialized_move_n(data_.GetAddress() + position, size_ - position, new_data.GetAddress() + position + 1);
+            }
+            else if constexpr (!std::is_copy_constructible_v<T>) {
 
                 try {
                     std::uninitialized_move_n(data_.GetAddress(), position, new_data.GetAddress());
@@ -265,19 +747,183 @@ public:
                 }
 
             }
-            std::destroy_n(data_.GetAddress(), size_);
+            DestroyRelocated(data_.GetAddress(), size_);
             data_.Swap(new_data);
         }
         else {
             T tmp(T(std::forward<Args>(args)...));
             new (end()) T(std::move(data_[size_ - 1]));
-            std::move_backward(data_.GetAddress() + position, end() - 1, end());
-            data_[position] = std::move(tmp);
+            try {
+                std::move_backward(data_.GetAddress() + position, end() - 1, end());
+                data_[position] = std::move(tmp);
+            }
+            catch (...) {
+                // Элемент за end() ещё не учтён в size_ — без зачистки здесь
+                // его деструктор не вызвал бы никто
+                std::destroy_at(end());
+                throw;
+            }
         }
         ++size_;
         return begin() + position;
     }
 
+    // Замещает содержимое элементами [first, last), переиспользуя ёмкость и уже
+    // построенные элементы через присваивание; реаллокация — только при нехватке места
+    template <typename InputIt>
+    void Assign(InputIt first, InputIt last) {
+        size_t count = static_cast<size_t>(std::distance(first, last));
+        if (count > data_.Capacity()) {
+            RawMemory<T, Alloc> new_data(count, data_.GetAllocator());
+            std::uninitialized_copy(first, last, new_data.GetAddress());
+            std::destroy_n(data_.GetAddress(), size_);
+            data_.Swap(new_data);
+        }
+        else {
+            size_t assign_count = std::min(count, size_);
+            InputIt it = first;
+            for (size_t i = 0; i < assign_count; ++i, ++it) {
+                data_[i] = *it;
+            }
+            if (size_ > count) {
+                std::destroy_n(data_.GetAddress() + count, size_ - count);
+            }
+            else {
+                std::uninitialized_copy(it, last, data_.GetAddress() + size_);
+            }
+        }
+        size_ = count;
+    }
+
+    // Замещает содержимое count копиями value по той же схеме
+    void Assign(size_t count, const T& value) {
+        if (count > data_.Capacity()) {
+            RawMemory<T, Alloc> new_data(count, data_.GetAllocator());
+            std::uninitialized_fill_n(new_data.GetAddress(), count, value);
+            std::destroy_n(data_.GetAddress(), size_);
+            data_.Swap(new_data);
+        }
+        else {
+            size_t assign_count = std::min(count, size_);
+            std::fill_n(data_.GetAddress(), assign_count, value);
+            if (size_ > count) {
+                std::destroy_n(data_.GetAddress() + count, size_ - count);
+            }
+            else {
+                std::uninitialized_fill_n(data_.GetAddress() + size_, count - size_, value);
+            }
+        }
+        size_ = count;
+    }
+
+    // Как Assign(first, last), но элементы диапазона перемещаются, а не копируются
+    template <typename InputIt>
+    void AssignMove(InputIt first, InputIt last) {
+        size_t count = static_cast<size_t>(std::distance(first, last));
+        if (count > data_.Capacity()) {
+            RawMemory<T, Alloc> new_data(count, data_.GetAllocator());
+            std::uninitialized_move(first, last, new_data.GetAddress());
+            std::destroy_n(data_.GetAddress(), size_);
+            data_.Swap(new_data);
+        }
+        else {
+            size_t assign_count = std::min(count, size_);
+            InputIt it = first;
+            for (size_t i = 0; i < assign_count; ++i, ++it) {
+                data_[i] = std::move(*it);
+            }
+            if (size_ > count) {
+                std::destroy_n(data_.GetAddress() + count, size_ - count);
+            }
+            else {
+                std::uninitialized_move(it, last, data_.GetAddress() + size_);
+            }
+        }
+        size_ = count;
+    }
+
+    // Добавляет элементы [first, last) в конец вектора; для forward-итераторов —
+    // не более чем за одну реаллокацию, однопроходные input-диапазоны нельзя
+    // измерить заранее, и они наполняются с амортизированным ростом
+    template <typename InputIt>
+    void AppendRange(InputIt first, InputIt last) {
+        using Category = typename std::iterator_traits<InputIt>::iterator_category;
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+            size_t count = static_cast<size_t>(std::distance(first, last));
+            if (count == 0) {
+                return;
+            }
+            if (size_ + count > Capacity()) {
+                this->Reserve(CalculateGrowth(size_ + count));
+            }
+            std::uninitialized_copy(first, last, data_.GetAddress() + size_);
+            size_ += count;
+        }
+        else {
+            for (; first != last; ++first) {
+                this->EmplaceBack(*first);
+            }
+        }
+    }
+
+    // Вставляет элементы [first, last) перед pos не более чем за одну реаллокацию
+    template <typename InputIt>
+    iterator Insert(const_iterator pos, InputIt first, InputIt last) {
+        size_t position = static_cast<size_t>(pos - begin());
+        using Category = typename std::iterator_traits<InputIt>::iterator_category;
+        if constexpr (!std::is_base_of_v<std::forward_iterator_tag, Category>) {
+            // Однопроходный диапазон: второй проход после std::distance читал бы
+            // исчерпанный источник — дописываем в конец и доворачиваем rotate
+            size_t old_size = size_;
+            for (; first != last; ++first) {
+                this->EmplaceBack(*first);
+            }
+            std::rotate(begin() + position, begin() + old_size, end());
+            return begin() + position;
+        }
+        size_t count = static_cast<size_t>(std::distance(first, last));
+        if (count == 0) {
+            return begin() + position;
+        }
+        if (size_ + count > Capacity()) {
+            RawMemory<T, Alloc> new_data(CalculateGrowth(size_ + count), data_.GetAllocator());
+            std::uninitialized_copy(first, last, new_data.GetAddress() + position);
+
+            try {
+                RelocateData(data_.GetAddress(), position, new_data.GetAddress());
+            }
+            catch (...) {
+                std::destroy_n(new_data.GetAddress() + position, count);
+                throw;
+            }
+
+            try {
+                RelocateData(data_.GetAddress() + position, size_ - position, new_data.GetAddress() + position + count);
+            }
+            catch (...) {
+                std::destroy_n(new_data.GetAddress(), position + count);
+                throw;
+            }
+
+            DestroyRelocated(data_.GetAddress(), size_);
+            data_.Swap(new_data);
+        }
+        else {
+            std::uninitialized_copy(first, last, end());
+            try {
+                std::rotate(begin() + position, begin() + size_, begin() + size_ + count);
+            }
+            catch (...) {
+                // Элементы за end() ещё не учтены в size_ — без зачистки здесь
+                // их деструкторы не вызвал бы никто
+                std::destroy_n(end(), count);
+                throw;
+            }
+        }
+        size_ += count;
+        return begin() + position;
+    }
+
     iterator Insert(const_iterator pos, const T& value) {
         return this->Emplace(pos, value);
     }
@@ -286,56 +932,299 @@ public:
         return this->Emplace(pos, std::move(value));
     }
 
-    void PopBack() /* noexcept */ {
+    ADVANCED_VECTOR_CONSTEXPR void PopBack() /* noexcept */ {
+        std::destroy_at(data_.GetAddress() + size_ - 1);
+        --size_;
+    }
+
+    // Забирает последний элемент и снимает его одним шагом — цикл слива
+    // стека обходится без пары «move-out + PopBack» на элемент
+    ADVANCED_VECTOR_CONSTEXPR T TakeBack() {
+        assert(size_ > 0);
+        T result(std::move(data_[size_ - 1]));
         std::destroy_at(data_.GetAddress() + size_ - 1);
         --size_;
+        return result;
+    }
+
+    // Усекает вектор до new_size элементов; для тривиально разрушаемых типов
+    // деструкторы не вызываются вовсе — меняется только счётчик
+    ADVANCED_VECTOR_CONSTEXPR void Truncate(size_t new_size) noexcept {
+        assert(new_size <= size_);
+        DestroyData(data_.GetAddress() + new_size, size_ - new_size);
+        size_ = new_size;
     }
 
     iterator Erase(const_iterator pos) /*noexcept(std::is_nothrow_move_assignable_v<T>)*/ {
         size_t position = static_cast<size_t>(pos - begin());
-        std::move(data_.GetAddress() + position + 1, end(), data_.GetAddress() + position);
-        std::destroy_at(end() - 1);
+        if constexpr (IsTriviallyRelocatableV<T>) {
+            std::destroy_at(data_.GetAddress() + position);
+            std::memmove(data_.GetAddress() + position, data_.GetAddress() + position + 1, (size_ - position - 1) * sizeof(T));
+        }
+        else {
+            std::move(data_.GetAddress() + position + 1, end(), data_.GetAddress() + position);
+            std::destroy_at(end() - 1);
+        }
         --size_;
         return begin() + position;
     }
 
-    size_t Size() const noexcept {
+    // Удаляет элемент за O(1), перемещая на его место последний;
+    // порядок оставшихся элементов не сохраняется
+    iterator SwapRemove(const_iterator pos) {
+        size_t position = static_cast<size_t>(pos - begin());
+        if (position + 1 != size_) {
+            data_[position] = std::move(data_[size_ - 1]);
+        }
+        this->PopBack();
+        return begin() + position;
+    }
+
+    // Удаляет диапазон [first, last) одним сдвигом хвоста
+    iterator Erase(const_iterator first, const_iterator last) {
+        size_t position = static_cast<size_t>(first - begin());
+        size_t count = static_cast<size_t>(last - first);
+        if (count == 0) {
+            return begin() + position;
+        }
+        if constexpr (IsTriviallyRelocatableV<T>) {
+            std::destroy_n(data_.GetAddress() + position, count);
+            std::memmove(data_.GetAddress() + position, data_.GetAddress() + position + count, (size_ - position - count) * sizeof(T));
+        }
+        else {
+            std::move(data_.GetAddress() + position + count, end(), data_.GetAddress() + position);
+            std::destroy_n(end() - count, count);
+        }
+        size_ -= count;
+        return begin() + position;
+    }
+
+    // Удаляет все элементы, удовлетворяющие pred, за один проход;
+    // возвращает число удалённых элементов
+    template <typename Pred>
+    size_t EraseIf(Pred pred) {
+        iterator new_end = std::remove_if(begin(), end(), pred);
+        size_t removed = static_cast<size_t>(end() - new_end);
+        DestroyData(new_end, removed);
+        size_ -= removed;
+        return removed;
+    }
+
+    ADVANCED_VECTOR_CONSTEXPR size_t Size() const noexcept {
         return size_;
     }
 
-    size_t Capacity() const noexcept {
+    ADVANCED_VECTOR_CONSTEXPR size_t Capacity() const noexcept {
         return data_.Capacity();
     }
 
-    void Reserve(size_t new_capacity) {
+    ADVANCED_VECTOR_CONSTEXPR void Reserve(size_t new_capacity) {
         if (new_capacity <= data_.Capacity()) {
             return;
         }
-        RawMemory<T> new_data(new_capacity);
-        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
-            std::uninitialized_move_n(data_.GetAddress(), size_, new_data.GetAddress());
+        if constexpr (IsTriviallyRelocatableV<T>) {
+            if (data_.TryGrow(new_capacity)) {
+                return;
+            }
         }
-        else {
-            std::uninitialized_copy_n(data_.GetAddress(), size_, new_data.GetAddress());
+        RawMemory<T, Alloc> new_data(new_capacity, data_.GetAllocator());
+        ADVANCED_VECTOR_STATS_HOOK(
+            ThreadVectorStats().reallocations += 1;
+            ThreadVectorStats().bytes_relocated += size_ * sizeof(T);
+        )
+        RelocateData(data_.GetAddress(), size_, new_data.GetAddress());
+        DestroyRelocated(data_.GetAddress(), size_);
+        data_.Swap(new_data);
+    }
+
+    // Уменьшает ёмкость до текущего размера, возвращая лишнюю память аллокатору
+    void ShrinkToFit() {
+        if (size_ == data_.Capacity()) {
+            return;
         }
-        std::destroy_n(data_.GetAddress(), size_);
+        RawMemory<T, Alloc> new_data(size_, data_.GetAllocator());
+        RelocateData(data_.GetAddress(), size_, new_data.GetAddress());
+        DestroyRelocated(data_.GetAddress(), size_);
         data_.Swap(new_data);
     }
 
-    void Swap(Vector& other) noexcept {
+    // Область параллельного добавления: слоты из заранее зарезервированного
+    // диапазона раздаются производителям атомарным инкрементом, конструирование
+    // идёт на месте без блокировок. Итоговый размер вектора фиксируется один раз
+    // в Commit (или в деструкторе области). Пока область жива, вектор нельзя
+    // трогать другими операциями, а конструкторы элементов не должны бросать:
+    // занятый слот при исключении останется несконструированным
+    class ParallelAppendScope {
+        friend class Vector;
+
+        ParallelAppendScope(Vector* owner, size_t first_slot, size_t limit) noexcept
+            : owner_(owner)
+            , next_(first_slot)
+            , limit_(limit) {
+        }
+
+    public:
+        ParallelAppendScope(const ParallelAppendScope&) = delete;
+        ParallelAppendScope& operator=(const ParallelAppendScope&) = delete;
+
+        ~ParallelAppendScope() {
+            Commit();
+        }
+
+        // Потокобезопасно: занимает следующий слот и конструирует элемент в нём
+        template <typename... Args>
+        T& EmplaceInto(Args&&... args) {
+            size_t slot = next_.fetch_add(1, std::memory_order_relaxed);
+            assert(slot < limit_);
+            return *ConstructAt(owner_->data_.GetAddress() + slot, std::forward<Args>(args)...);
+        }
+
+        // Делает сконструированные элементы видимыми через вектор
+        void Commit() noexcept {
+            if (owner_ != nullptr) {
+                owner_->size_ = next_.load(std::memory_order_relaxed);
+                owner_ = nullptr;
+            }
+        }
+
+    private:
+        Vector* owner_;
+        std::atomic<size_t> next_;
+        size_t limit_;
+    };
+
+    // Резервирует место под count новых элементов и открывает область,
+    // в которую несколько потоков могут добавлять элементы без блокировок
+    ParallelAppendScope MakeParallelAppendScope(size_t count) {
+        this->Reserve(size_ + count);
+        return ParallelAppendScope(this, size_, size_ + count);
+    }
+
+    // Создаёт вектор поверх внешнего буфера без копирования: первые size
+    // элементов buf должны быть сконструированы, capacity задаёт полную ёмкость.
+    // deleter вызывается при освобождении буфера; nullptr означает, что буфером
+    // владеет вызывающий (например, mmap-регион)
+    static Vector Adopt(T* buf, size_t size, size_t capacity,
+                        typename RawMemory<T, Alloc>::Deleter deleter) noexcept {
+        assert(size <= capacity);
+        Vector result;
+        RawMemory<T, Alloc> adopted(buf, capacity, deleter);
+        result.data_.Swap(adopted);
+        result.size_ = size;
+        return result;
+    }
+
+    // Материализует диапазон (в том числе ленивый конвейер) одним проходом:
+    // когда размер известен — через std::size или проход forward-итераторами —
+    // буфер выделяется сразу и элементы строятся без проверок ёмкости;
+    // однопроходные input-диапазоны наполняются с амортизированным ростом
+    template <typename Range>
+    static Vector FromRange(Range&& range) {
+        using std::begin;
+        using std::end;
+        auto first = begin(range);
+        auto last = end(range);
+        using Category = typename std::iterator_traits<decltype(first)>::iterator_category;
+        Vector result;
+        if constexpr (HasRangeSize<Range>::value) {
+            result.Reserve(std::size(range));
+            for (; first != last; ++first) {
+                result.EmplaceBackUnchecked(*first);
+            }
+        }
+        else if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+            result.Reserve(static_cast<size_t>(std::distance(first, last)));
+            for (; first != last; ++first) {
+                result.EmplaceBackUnchecked(*first);
+            }
+        }
+        else {
+            for (; first != last; ++first) {
+                result.EmplaceBack(*first);
+            }
+        }
+        return result;
+    }
+
+    // Замораживает содержимое в неизменяемый снимок с разделяемым владением;
+    // вектор остаётся пустым. Определение — в shared_vector.h
+    SharedVector<T, Alloc> Freeze();
+
+    // Передаёт владение буфером вызывающему, оставляя вектор пустым.
+    // В буфере остаются сконструированными первые Size() элементов —
+    // принявшая сторона отвечает за их разрушение
+    RawMemory<T, Alloc> ReleaseBuffer() noexcept {
+        size_ = 0;
+        RawMemory<T, Alloc> released;
+        data_.Swap(released);
+        return released;
+    }
+
+    ADVANCED_VECTOR_CONSTEXPR void Swap(Vector& other) noexcept {
         data_.Swap(other.data_);
         std::swap(size_, other.size_);
+        std::swap(growth_, other.growth_);
+        std::swap(growth_increment_, other.growth_increment_);
+    }
+
+    // Задаёт стратегию роста; increment используется только политикой FixedIncrement
+    void SetGrowthPolicy(GrowthPolicy policy, size_t increment = 0) noexcept {
+        assert(policy != GrowthPolicy::FixedIncrement || increment > 0);
+        growth_ = policy;
+        growth_increment_ = increment;
     }
 
-    const T& operator[](size_t index) const noexcept {
+    ADVANCED_VECTOR_CONSTEXPR const T& operator[](size_t index) const noexcept {
         return data_[index];
     }
 
-    T& operator[](size_t index) noexcept {
+    ADVANCED_VECTOR_CONSTEXPR T& operator[](size_t index) noexcept {
         return data_[index];
     }
 
 private:
-    RawMemory<T> data_;
+    // Вычисляет ёмкость, достаточную для min_capacity элементов, согласно текущей стратегии
+    ADVANCED_VECTOR_CONSTEXPR size_t CalculateGrowth(size_t min_capacity) const noexcept {
+        size_t current = data_.Capacity();
+        size_t grown;
+        switch (growth_) {
+            case GrowthPolicy::Golden:
+                grown = current + current / 2;
+                break;
+            case GrowthPolicy::FixedIncrement:
+                grown = current + growth_increment_;
+                break;
+            default:
+                grown = current * 2;
+                break;
+        }
+        grown = std::max({grown, min_capacity, size_t{1}});
+        if (growth_ == GrowthPolicy::PageRounded) {
+            constexpr size_t PAGE_SIZE = 4096;
+            constexpr size_t ELEMS_PER_PAGE = std::max(PAGE_SIZE / sizeof(T), size_t{1});
+            grown = (grown + ELEMS_PER_PAGE - 1) / ELEMS_PER_PAGE * ELEMS_PER_PAGE;
+        }
+        return grown;
+    }
+
+    RawMemory<T, Alloc> data_;
     size_t size_ = 0;
-};
\ No newline at end of file
+    GrowthPolicy growth_ = GrowthPolicy::Double;
+    size_t growth_increment_ = 0;
+};
+
+// Хвост конвейера в стиле ranges: range | ToVector() материализует диапазон
+// в Vector через FromRange с теми же подсказками размера
+struct ToVectorTag {};
+
+inline ToVectorTag ToVector() noexcept {
+    return {};
+}
+
+template <typename Range,
+          typename = std::void_t<decltype(std::begin(std::declval<Range&>())),
+                                 decltype(std::end(std::declval<Range&>()))>>
+auto operator|(Range&& range, ToVectorTag) {
+    using T = std::decay_t<decltype(*std::begin(range))>;
+    return Vector<T>::FromRange(std::forward<Range>(range));
+}
\ No newline at end of file
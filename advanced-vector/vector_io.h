@@ -0,0 +1,90 @@
+#pragma once
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+
+#include "vector.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Потоковая сериализация Vector для тривиально копируемых типов:
+// 8-байтовый заголовок с числом элементов, затем содержимое буфера одним блоком.
+// Формат привязан к платформе (порядок байтов, размер T) — это формат
+// контрольных точек, а не обмена между архитектурами
+
+template <typename T, typename Alloc>
+void WriteTo(const Vector<T, Alloc>& vector, std::ostream& out) {
+    static_assert(std::is_trivially_copyable_v<T>, "WriteTo applies only to trivially copyable types");
+    uint64_t size = vector.Size();
+    out.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    out.write(reinterpret_cast<const char*>(vector.begin()), static_cast<std::streamsize>(size * sizeof(T)));
+}
+
+// Читает вектор одним bulk-чтением прямо в неинициализированный буфер
+template <typename T, typename Alloc = NewDeleteAllocator<T>>
+Vector<T, Alloc> ReadFrom(std::istream& in) {
+    static_assert(std::is_trivially_copyable_v<T>, "ReadFrom applies only to trivially copyable types");
+    uint64_t size = 0;
+    in.read(reinterpret_cast<char*>(&size), sizeof(size));
+    // Заголовку нельзя доверять: переполнение size * sizeof(T) свернуло бы
+    // и выделение, и длину чтения к крошечным значениям без единой ошибки
+    if (!in || size > SIZE_MAX / sizeof(T)) {
+        throw std::runtime_error("ReadFrom: повреждённый заголовок");
+    }
+    Vector<T, Alloc> result;
+    result.ResizeUninitialized(size);
+    in.read(reinterpret_cast<char*>(result.begin()), static_cast<std::streamsize>(size * sizeof(T)));
+    if (!in) {
+        throw std::runtime_error("ReadFrom: повреждённый или усечённый поток");
+    }
+    return result;
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+
+// Отображает файл, записанный WriteTo, в память и оборачивает отображение
+// в Vector без чтения и копирования. Отображение приватное (copy-on-write):
+// изменения элементов остаются локальными и не попадают в файл
+template <typename T, typename Alloc = NewDeleteAllocator<T>>
+Vector<T, Alloc> MapFromFile(const char* path) {
+    static_assert(std::is_trivially_copyable_v<T>, "MapFromFile applies only to trivially copyable types");
+    static_assert(alignof(T) <= sizeof(uint64_t), "элементы в файле лежат со смещением 8 байт");
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("MapFromFile: не удалось открыть файл");
+    }
+    struct stat st {};
+    if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(uint64_t)) {
+        ::close(fd);
+        throw std::runtime_error("MapFromFile: не удалось прочитать размер файла");
+    }
+    // Заголовок читается до отображения: число элементов сверяется с размером
+    // файла, иначе усечённая контрольная точка обернулась бы SIGBUS при первом
+    // обращении к элементу вместо исключения
+    uint64_t size = 0;
+    if (::pread(fd, &size, sizeof(size), 0) != static_cast<ssize_t>(sizeof(size))
+        || size > (static_cast<size_t>(st.st_size) - sizeof(uint64_t)) / sizeof(T)) {
+        ::close(fd);
+        throw std::runtime_error("MapFromFile: повреждённый или усечённый файл");
+    }
+    // Отображаются ровно заголовок и элементы — тогда длина munmap в деструкторе
+    // восстанавливается из ёмкости точно, без утечки хвостовых страниц
+    size_t mapped_bytes = sizeof(uint64_t) + static_cast<size_t>(size) * sizeof(T);
+    void* base = ::mmap(nullptr, mapped_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (base == MAP_FAILED) {
+        throw std::runtime_error("MapFromFile: mmap не удался");
+    }
+    T* data = reinterpret_cast<T*>(static_cast<char*>(base) + sizeof(uint64_t));
+    return Vector<T, Alloc>::Adopt(data, size, size, [](T* buf, size_t capacity) {
+        ::munmap(reinterpret_cast<char*>(buf) - sizeof(uint64_t), capacity * sizeof(T) + sizeof(uint64_t));
+        });
+}
+
+#endif
@@ -0,0 +1,26 @@
+#pragma once
+#include <cstddef>
+
+// Счётчики аллокаций и реаллокаций контейнеров. Слой включается флагом
+// компиляции -DADVANCED_VECTOR_STATS и не стоит ничего, когда он выключен:
+// без флага vector.h не подключает этот заголовок и не генерирует учёт
+struct VectorStats {
+    size_t allocations = 0;      // вызовы RawMemory::Allocate
+    size_t deallocations = 0;    // вызовы RawMemory::Deallocate
+    size_t bytes_allocated = 0;  // суммарно запрошено байт
+    size_t current_bytes = 0;    // выделено байт сейчас
+    size_t peak_bytes = 0;       // пик одновременно выделенных байт
+    size_t reallocations = 0;    // случаев роста с переносом содержимого
+    size_t bytes_relocated = 0;  // байт перенесено при росте
+
+    void Reset() noexcept {
+        *this = VectorStats{};
+    }
+};
+
+// Потоколокальный реестр: метрики снимаются потоком-владельцем без
+// синхронизации, например в конце обработки запроса
+inline VectorStats& ThreadVectorStats() noexcept {
+    static thread_local VectorStats stats;
+    return stats;
+}